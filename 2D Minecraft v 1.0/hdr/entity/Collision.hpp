@@ -29,10 +29,41 @@ namespace engine {
 			void clear();
 		}; 
 
-		bool floor(const Entity& entity, gs::Vec2f position, gs::Vec2f size); 
-		bool ceil(const Entity& entity, gs::Vec2f position, gs::Vec2f size); 
-		bool leftWall(const Entity& entity, gs::Vec2f position, gs::Vec2f size);
-		bool rightWall(const Entity& entity, gs::Vec2f position, gs::Vec2f size); 
+		// Collision properties of each block, cached from the block info so 
+		// tiles don't need their float properties read during collision. 
+		struct TileCollision {
+			CollisionType collisionType; 
+			// How far below the top of the tile it's surface is. 
+			float floorOffset; 
+		};
+
+		// A box which is moved through the tile grid. Bodies that only 
+		// collide with tiles, such as particles, use it directly. 
+		struct Hitbox {
+			gs::Vec2f position; 
+			gs::Vec2f velocity; 
+			gs::Vec2f size; 
+			gs::Vec2f velocityScaler; 
+			// Number of ticks of movement the velocity is applied for. 
+			int physicsTicks; 
+			Collisions collisions; 
+		};
+
+		// Result of a line of sight check between two tiles. It stays 
+		// valid until a block is edited in one of the chunks the line spans.
+		struct EyeSightQuery {
+			gs::Vec2i startTile; 
+			gs::Vec2i endTile; 
+			unsigned int blockEditStamps; 
+			bool valid; 
+			bool clear; 
+		};
+
+		constexpr int eyeSightQueryCacheSize = 256; 
+
+		extern TileCollision tileCollisions[BlockInfo::numOfBlocks]; 
+		extern EyeSightQuery eyeSightQueries[eyeSightQueryCacheSize]; 
+
 		bool intersect(
 			const Entity& entity1, const Entity& entity2, 
 			float tolerance = 0.0f
@@ -46,10 +77,19 @@ namespace engine {
 			const Entity& entity1, const Entity& entity2, bool fromCenter = true
 		);
 		gs::Vec2f calculateKnockback(gs::Vec2f delta, float multiplier = 1.0f); 
+		// Checks for solid tiles between the tiles the entities are in, 
+		// reusing earlier results for the same tiles. 
 		bool doEntitiesHaveEyeSight(const Entity& entity1, const Entity& entity2); 
+		// Walks the tiles along the line between the two tile centers. 
+		bool isLineOfSightClear(gs::Vec2i startTile, gs::Vec2i endTile); 
+		// Combines the block edit stamps of the chunks between two xpos. 
+		unsigned int getBlockEditStamps(int startXpos, int endXpos); 
 
-		void applyCollision(Entity& entity, const World& world, bool applyForward = true); 
-		void applyCollision(Particle& particle, const World& world, bool applyForward = true); 
+		void loadTileCollisions(); 
+		// Sweeps the hitbox along it's velocity, stopping it at the first 
+		// solid tiles in the way. 
+		void applyCollision(Hitbox& hitbox, const World& world); 
+		void applyCollision(Entity& entity, const World& world); 
 		void attract(Entity& planetEntity, Entity& moonEntity, bool planetFixed = true); 
 	}
 }
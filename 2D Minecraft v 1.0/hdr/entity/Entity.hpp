@@ -3,10 +3,15 @@
 // Dependencies
 #include "Model.hpp"
 #include "Collision.hpp"
+#include "EntityGrid.hpp"
 
 namespace engine {
 	using collision::Collisions; 
 
+	// How often an entity is updated, based on it's distance from the player
+	// and whether anything is happening to it. 
+	enum class UpdateTier { Full, Reduced, Frozen, Sleeping, End };
+
 	class Entity {
 	public:
 		ModelTransform modelTransform; 
@@ -18,6 +23,12 @@ namespace engine {
 		float mass; 
 		int immunityFrames; 
 		bool dead; 
+		UpdateTier updateTier; 
+		int ticksSinceUpdate; 
+		// Number of ticks the current update stands in for. 
+		int updateTicks; 
+		// Number of ticks of movement the current update applies. 
+		int physicsTicks; 
 
 		enum class Type { None, PlayerEntity, Mob, ItemEntity, ProjectileEntity };
 
@@ -27,17 +38,26 @@ namespace engine {
 		virtual void update(); 
 
 		virtual std::string getSaveString() const; 
-
-		static int numOfEntities; 
 	protected:
 		void updatePosition(); 
 	};
 
-	using EntityPair = std::pair<Entity::Type, Entity*>; 
-
-	extern std::vector<EntityPair> entities; 
-	
-	void addEntity(Entity::Type type, Entity* entity); 
+	constexpr float reducedUpdateDistance = 32.0f; 
+	constexpr float frozenUpdateDistance = 96.0f; 
+	constexpr int reducedUpdateInterval = 4; 
+	// Entities which would move further than this between reduced updates 
+	// are updated every tick, so they can't pass through blocks. 
+	constexpr float maxReducedUpdateStep = 0.5f; 
+	constexpr int maxTicksAsleep = 60; 
+
+	extern int entityUpdateTierCounts[static_cast<int>(UpdateTier::End)]; 
+
+	// Includes the player. 
+	int getNumOfEntities(); 
+	// Returns true if the entity should be updated this tick, and sets the 
+	// number of ticks the update covers. Entities that can sleep are left 
+	// alone until something disturbs them. 
+	bool scheduleEntityUpdate(Entity& entity, bool canSleep = false); 
 	void updateEntities(); 
 	void deleteEntities(); 
 }
\ No newline at end of file
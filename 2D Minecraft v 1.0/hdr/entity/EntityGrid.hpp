@@ -0,0 +1,250 @@
+#pragma once
+
+// Dependencies
+#include "EntityPool.hpp"
+#include "../world/PathFinding.hpp"
+
+namespace engine {
+	// A broad-phase spatial index over the entities of a pool. Entities are
+	// bucketed by the cell their center is in, and by the chunk they're in, 
+	// and are moved between buckets as they're updated. 
+	template<typename Type>
+	class EntityGrid {
+	public:
+		// Width and height of a cell in tiles. 
+		static constexpr int cellSize = 4; 
+
+		EntityGrid(EntityPool<Type>& pool); 
+		~EntityGrid() = default; 
+
+		// Adds the entity to both the pool and the grid. 
+		Type& add(const Type& entity); 
+		// Moves the entity into the cell it's position is in, adding it to 
+		// the grid if it isn't already. 
+		void update(int entityIndex); 
+		// Removes the entity from both the grid and the pool. 
+		void remove(int entityIndex); 
+		void remove(EntityHandle handle); 
+		// Clears both the grid and the pool. 
+		void clear(); 
+
+		// Calls the function with every entity in the cells overlapping the 
+		// area. Callers are expected to do any exact intersection tests. 
+		// Note: Entities can't be added or removed during a query. 
+		template<typename Function>
+		void forEachInArea(gs::Vec2f min, gs::Vec2f max, Function function); 
+		// Calls the function with every entity closer than the radius. 
+		template<typename Function>
+		void forEachInRadius(gs::Vec2f center, float radius, Function function); 
+		// Returns the closest entity within the radius that satisfies the 
+		// predicate, or nullptr if there isn't one. 
+		template<typename Predicate>
+		Type* findNearest(gs::Vec2f center, float radius, Predicate predicate); 
+		// Copies the handles of the entities in the chunk, in the order they
+		// entered it. 
+		void getChunkHandles(
+			int chunkOffset, std::vector<EntityHandle>& handles) const; 
+	private:
+		// Where each pool slot is stored in the grid. 
+		struct SlotEntry {
+			gs::Vec2i cell; 
+			int chunkOffset; 
+			bool inGrid; 
+		};
+
+		EntityPool<Type>& pool; 
+		std::unordered_map<gs::Vec2i, std::vector<EntityHandle>, HashContainer>
+			cells; 
+		std::unordered_map<int, std::vector<EntityHandle>> chunkBuckets; 
+		// Indexed by the slot of each handle. 
+		std::vector<SlotEntry> slotEntries; 
+
+		static gs::Vec2i getCell(gs::Vec2f position); 
+		static int getChunkOffset(gs::Vec2f position); 
+		void removeFromBuckets(EntityHandle handle); 
+	};
+
+	template<typename Type>
+	EntityGrid<Type>::EntityGrid(EntityPool<Type>& pool) : 
+		pool(pool)
+	{
+	}
+
+	template<typename Type>
+	Type& EntityGrid<Type>::add(const Type& entity) {
+		pool.add(entity); 
+		update(pool.size() - 1); 
+
+		return pool[pool.size() - 1]; 
+	}
+	template<typename Type>
+	void EntityGrid<Type>::update(int entityIndex) {
+		const EntityHandle handle = pool.getHandle(entityIndex); 
+		const gs::Vec2f position = pool[entityIndex].position; 
+		const gs::Vec2i cell = getCell(position); 
+		const int chunkOffset = getChunkOffset(position); 
+
+		if (handle.slotIndex >= slotEntries.size())
+			slotEntries.resize(handle.slotIndex + 1, { {}, 0, false }); 
+
+		SlotEntry& slotEntry = slotEntries[handle.slotIndex]; 
+
+		if (slotEntry.inGrid) {
+			// Most entities stay within their cell between updates. 
+			if (slotEntry.cell == cell && slotEntry.chunkOffset == chunkOffset)
+				return; 
+
+			removeFromBuckets(handle); 
+		}
+
+		cells[cell].push_back(handle); 
+		chunkBuckets[chunkOffset].push_back(handle); 
+		slotEntry = { cell, chunkOffset, true }; 
+	}
+	template<typename Type>
+	void EntityGrid<Type>::remove(int entityIndex) {
+		const EntityHandle handle = pool.getHandle(entityIndex); 
+
+		if (handle.slotIndex < slotEntries.size() 
+			&& slotEntries[handle.slotIndex].inGrid) 
+		{
+			removeFromBuckets(handle); 
+			slotEntries[handle.slotIndex].inGrid = false; 
+		}
+
+		pool.remove(entityIndex); 
+	}
+	template<typename Type>
+	void EntityGrid<Type>::remove(EntityHandle handle) {
+		const int entityIndex = pool.getIndex(handle); 
+
+		if (entityIndex != -1)
+			remove(entityIndex); 
+	}
+	template<typename Type>
+	void EntityGrid<Type>::clear() {
+		cells.clear(); 
+		chunkBuckets.clear(); 
+
+		for (SlotEntry& slotEntry : slotEntries)
+			slotEntry.inGrid = false; 
+
+		pool.clear(); 
+	}
+
+	template<typename Type>
+	template<typename Function>
+	void EntityGrid<Type>::forEachInArea(
+		gs::Vec2f min, gs::Vec2f max, Function function) 
+	{
+		const gs::Vec2i minCell = getCell(min); 
+		const gs::Vec2i maxCell = getCell(max); 
+
+		for (int ypos = minCell.y; ypos <= maxCell.y; ypos++) {
+			for (int xpos = minCell.x; xpos <= maxCell.x; xpos++) {
+				const auto cell = cells.find(gs::Vec2i(xpos, ypos)); 
+
+				if (cell == cells.end())
+					continue; 
+
+				for (EntityHandle handle : cell->second) {
+					Type* entity = pool.get(handle); 
+
+					if (entity != nullptr)
+						function(*entity); 
+				}
+			}
+		}
+	}
+	template<typename Type>
+	template<typename Function>
+	void EntityGrid<Type>::forEachInRadius(
+		gs::Vec2f center, float radius, Function function) 
+	{
+		const gs::Vec2f extent = gs::Vec2f(radius, radius); 
+
+		forEachInArea(center - extent, center + extent, [&](Type& entity) {
+			const gs::Vec2f delta = entity.position - center; 
+
+			if ((delta.x * delta.x) + (delta.y * delta.y) < radius * radius)
+				function(entity); 
+		}); 
+	}
+	template<typename Type>
+	template<typename Predicate>
+	Type* EntityGrid<Type>::findNearest(
+		gs::Vec2f center, float radius, Predicate predicate) 
+	{
+		Type* nearestEntity = nullptr; 
+		float nearestDistance = radius * radius; 
+
+		forEachInRadius(center, radius, [&](Type& entity) {
+			const gs::Vec2f delta = entity.position - center; 
+			const float distance = (delta.x * delta.x) + (delta.y * delta.y); 
+
+			if (distance < nearestDistance && predicate(entity)) {
+				nearestEntity = &entity; 
+				nearestDistance = distance; 
+			}
+		}); 
+
+		return nearestEntity; 
+	}
+
+	template<typename Type>
+	void EntityGrid<Type>::getChunkHandles(
+		int chunkOffset, std::vector<EntityHandle>& handles) const 
+	{
+		const auto chunkBucket = chunkBuckets.find(chunkOffset); 
+
+		handles.clear(); 
+
+		if (chunkBucket != chunkBuckets.end())
+			handles = chunkBucket->second; 
+	}
+
+	template<typename Type>
+	gs::Vec2i EntityGrid<Type>::getCell(gs::Vec2f position) {
+		return gs::Vec2i(
+			static_cast<int>(std::floor(position.x / cellSize)), 
+			static_cast<int>(std::floor(position.y / cellSize))
+		); 
+	}
+	template<typename Type>
+	int EntityGrid<Type>::getChunkOffset(gs::Vec2f position) {
+		return World::getChunkOffset(static_cast<int>(position.x)); 
+	}
+	template<typename Type>
+	void EntityGrid<Type>::removeFromBuckets(EntityHandle handle) {
+		const SlotEntry& slotEntry = slotEntries[handle.slotIndex]; 
+		const auto cell = cells.find(slotEntry.cell); 
+		const auto chunkBucket = chunkBuckets.find(slotEntry.chunkOffset); 
+		std::vector<EntityHandle>& cellHandles = cell->second; 
+		std::vector<EntityHandle>& chunkHandles = chunkBucket->second; 
+
+		for (int handleIndex = 0; handleIndex < cellHandles.size(); 
+			handleIndex++) 
+		{
+			if (cellHandles[handleIndex] == handle) {
+				cellHandles[handleIndex] = cellHandles.back(); 
+				cellHandles.pop_back(); 
+				break; 
+			}
+		}
+
+		// Chunk buckets keep their order, so entities are saved in the order
+		// they were loaded. 
+		const auto chunkHandle = std::find(
+			chunkHandles.begin(), chunkHandles.end(), handle); 
+
+		if (chunkHandle != chunkHandles.end())
+			chunkHandles.erase(chunkHandle); 
+
+		// Empty buckets are erased, so the grid only grows with the area 
+		// entities are currently in. 
+		if (cellHandles.empty())
+			cells.erase(cell); 
+		if (chunkHandles.empty())
+			chunkBuckets.erase(chunkBucket); 
+	}
+}
\ No newline at end of file
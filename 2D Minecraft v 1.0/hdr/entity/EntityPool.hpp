@@ -0,0 +1,186 @@
+#pragma once
+
+// Dependencies
+#include "../Resources.hpp"
+
+namespace engine {
+	// Refers to an entity stored in a pool. A handle keeps pointing at the 
+	// same entity as it's moved around the pool, and stops resolving once 
+	// the entity is removed. 
+	struct EntityHandle {
+		int slotIndex = -1; 
+		int generation = 0; 
+
+		bool operator==(const EntityHandle& other) const = default; 
+	};
+
+	// Stores entities of a single type contiguously. Removing an entity moves
+	// the last entity into it's place, so the pool never has gaps. 
+	template<typename Type>
+	class EntityPool {
+	public:
+		using Iterator = typename std::vector<Type>::iterator; 
+		using ConstIterator = typename std::vector<Type>::const_iterator; 
+
+		EntityPool() = default; 
+		~EntityPool() = default; 
+
+		// Constructs a new entity in place, and returns it. 
+		template<typename... Args>
+		Type& create(Args&&... args); 
+		Type& add(const Type& entity); 
+		// Note: Invalidates references to the last entity in the pool. 
+		void remove(int entityIndex); 
+		void clear(); 
+
+		// Returns nullptr if the entity has been removed. 
+		Type* get(EntityHandle handle); 
+		const Type* get(EntityHandle handle) const; 
+		EntityHandle getHandle(int entityIndex) const; 
+		EntityHandle getHandle(const Type& entity) const; 
+		// Returns -1 if the entity has been removed. 
+		int getIndex(EntityHandle handle) const; 
+		int size() const; 
+		bool empty() const; 
+
+		Type& operator[](int entityIndex); 
+		const Type& operator[](int entityIndex) const; 
+		Iterator begin(); 
+		Iterator end(); 
+		ConstIterator begin() const; 
+		ConstIterator end() const; 
+	private:
+		struct Slot {
+			int entityIndex; 
+			int generation; 
+		};
+
+		std::vector<Type> entities; 
+		// Slot of each entity, stored in the same order as the entities. 
+		std::vector<int> entitySlots; 
+		std::vector<Slot> slots; 
+		std::vector<int> freeSlots; 
+
+		void allocateSlot(); 
+	};
+
+	template<typename Type>
+	template<typename... Args>
+	Type& EntityPool<Type>::create(Args&&... args) {
+		allocateSlot(); 
+		entities.emplace_back(std::forward<Args>(args)...); 
+
+		return entities.back(); 
+	}
+	template<typename Type>
+	Type& EntityPool<Type>::add(const Type& entity) {
+		allocateSlot(); 
+		entities.push_back(entity); 
+
+		return entities.back(); 
+	}
+	template<typename Type>
+	void EntityPool<Type>::remove(int entityIndex) {
+		const int lastIndex = static_cast<int>(entities.size()) - 1; 
+		const int slotIndex = entitySlots[entityIndex]; 
+
+		// Bumping the generation invalidates any handles to the entity. 
+		slots[slotIndex].entityIndex = -1; 
+		slots[slotIndex].generation++; 
+		freeSlots.push_back(slotIndex); 
+
+		if (entityIndex != lastIndex) {
+			entities[entityIndex] = std::move(entities[lastIndex]); 
+			entitySlots[entityIndex] = entitySlots[lastIndex]; 
+			slots[entitySlots[entityIndex]].entityIndex = entityIndex; 
+		}
+
+		entities.pop_back(); 
+		entitySlots.pop_back(); 
+	}
+	template<typename Type>
+	void EntityPool<Type>::clear() {
+		for (int entityIndex = static_cast<int>(entities.size()) - 1; 
+			entityIndex >= 0; entityIndex--)
+			remove(entityIndex); 
+	}
+	template<typename Type>
+	Type* EntityPool<Type>::get(EntityHandle handle) {
+		const int entityIndex = getIndex(handle); 
+
+		return entityIndex != -1 ? &entities[entityIndex] : nullptr; 
+	}
+	template<typename Type>
+	const Type* EntityPool<Type>::get(EntityHandle handle) const {
+		return const_cast<EntityPool<Type>*>(this)->get(handle); 
+	}
+	template<typename Type>
+	EntityHandle EntityPool<Type>::getHandle(int entityIndex) const {
+		const int slotIndex = entitySlots[entityIndex]; 
+
+		return { slotIndex, slots[slotIndex].generation }; 
+	}
+	template<typename Type>
+	EntityHandle EntityPool<Type>::getHandle(const Type& entity) const {
+		return getHandle(static_cast<int>(&entity - entities.data())); 
+	}
+	template<typename Type>
+	int EntityPool<Type>::getIndex(EntityHandle handle) const {
+		if (handle.slotIndex < 0 || handle.slotIndex >= slots.size())
+			return -1; 
+
+		const Slot& slot = slots[handle.slotIndex]; 
+
+		return slot.generation == handle.generation ? slot.entityIndex : -1; 
+	}
+	template<typename Type>
+	int EntityPool<Type>::size() const {
+		return static_cast<int>(entities.size()); 
+	}
+	template<typename Type>
+	bool EntityPool<Type>::empty() const {
+		return entities.empty(); 
+	}
+	template<typename Type>
+	Type& EntityPool<Type>::operator[](int entityIndex) {
+		return entities[entityIndex]; 
+	}
+	template<typename Type>
+	const Type& EntityPool<Type>::operator[](int entityIndex) const {
+		return entities[entityIndex]; 
+	}
+	template<typename Type>
+	typename EntityPool<Type>::Iterator EntityPool<Type>::begin() {
+		return entities.begin(); 
+	}
+	template<typename Type>
+	typename EntityPool<Type>::Iterator EntityPool<Type>::end() {
+		return entities.end(); 
+	}
+	template<typename Type>
+	typename EntityPool<Type>::ConstIterator EntityPool<Type>::begin() const {
+		return entities.begin(); 
+	}
+	template<typename Type>
+	typename EntityPool<Type>::ConstIterator EntityPool<Type>::end() const {
+		return entities.end(); 
+	}
+
+	template<typename Type>
+	void EntityPool<Type>::allocateSlot() {
+		int slotIndex; 
+
+		// Reuses the slots of removed entities before growing. 
+		if (!freeSlots.empty()) {
+			slotIndex = freeSlots.back(); 
+			freeSlots.pop_back(); 
+		}
+		else {
+			slotIndex = static_cast<int>(slots.size()); 
+			slots.push_back({ -1, 0 }); 
+		}
+
+		slots[slotIndex].entityIndex = static_cast<int>(entities.size()); 
+		entitySlots.push_back(slotIndex); 
+	}
+}
\ No newline at end of file
@@ -8,5 +8,4 @@ namespace engine {
 	constexpr float terminalVelocity = 0.5f; 
 
 	void applyGravity(Entity& entity); 
-	void applyGravity(Particle& particle); 
 }
\ No newline at end of file
@@ -5,25 +5,39 @@
 #include "../inventory/Item.hpp"
 
 namespace engine {
-	class ItemEntity : public Entity {
+	class ItemEntity final : public Entity {
 	public:
 		ItemContainer itemContainer; 
 		int timeLeft; 
+		// Ticks until the item entity can be picked up or merged. 
+		int pickupDelay; 
 
 		ItemEntity(); 
 		~ItemEntity(); 
 
 		void update() override; 
+		// True if the item entity is lying still on the ground. 
+		bool isResting() const; 
 
 		std::string getSaveString() const override; 
 
 		static constexpr float maximumItemPickupDistance = 1.5f; 
+		static constexpr float itemMergingDistance = 1.0f; 
+		static constexpr float restingVelocity = 0.001f; 
+		static constexpr int ticksBetweenItemMerging = 10; 
 		static const int defaultNumberOfTicksAlive; 
+		static int ticksUntilNextItemMerging; 
 
 		static void dropItemEntity(
 			ItemContainer itemContainer, gs::Vec2f position, 
 			gs::Vec2f velocity = gs::Vec2f(-1, -1), bool preventPickup = false
 		); 
+		// Combines nearby item entities holding the same item, up to the 
+		// item's stack size. Emptied item entities die on their next update. 
+		static void mergeItemEntities(); 
 	private:
 	};
+
+	extern EntityPool<ItemEntity> itemEntities; 
+	extern EntityGrid<ItemEntity> itemEntityGrid; 
 }
\ No newline at end of file
@@ -2,11 +2,12 @@
 
 // Dependencies
 #include "Gravity.hpp"
+#include "Navigation.hpp"
 #include "../inventory/LootTable.hpp"
 #include "../audio/AudioEnviroment.hpp"
 
 namespace engine {
-	class Mob : public Entity {
+	class Mob final : public Entity {
 	public:
 		enum Type { Zombie, Skeleton, Creeper, Pig, Cow, End } type;
 		enum class Behavior { Passive, Hostile } behavior;
@@ -19,6 +20,9 @@ namespace engine {
 		void init(); 
 		void update() override; 
 		void hurt(int damage); 
+		// True for passive mobs standing still with nothing to do. 
+		bool isIdle() const; 
+		bool isBurning() const; 
 
 		std::string getSaveString() const override; 
 
@@ -34,6 +38,10 @@ namespace engine {
 		static const audio::SoundEvent::Id mobDeathSoundEvents[End]; 
 		static const int hostileMobSpawnCap, passiveMobSpawnCap; 
 		static const int hostileMobUnloadDistance; 
+		static constexpr float targetDeltaThreshold = 0.1f; 
+		static constexpr float jumpVerticalVelocity = -0.22f; 
+		// Ticks between finding new paths to a moving target. 
+		static constexpr int ticksBetweenPathing = 20; 
 		static int numOfHostileMobs, numOfPassiveMobs; 
 		static bool burnUndeadHostileMobs; 
 	private:
@@ -47,5 +55,20 @@ namespace engine {
 		int timeSinceLastAmbientSoundEvent; 
 		int skeletonShootingCooldown; 
 		int creeperDetonationTicks; 
+		std::vector<navigation::Waypoint> path; 
+		int pathIndex; 
+		int ticksUntilPathing; 
+
+		// Walks along a path towards the target entity, heading straight 
+		// for it when no path is available. 
+		void navigateTo(const Entity& targetEntity); 
+		// Returns true on average once every number of ticks. 
+		bool rollChance(int averageTicks) const; 
 	};
+
+	extern EntityPool<Mob> mobs; 
+	extern EntityGrid<Mob> mobGrid; 
+
+	// Removes the mob from the pool and grid, and from the mob counts. 
+	void removeMob(int mobIndex); 
 }
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+// Dependencies
+#include "Collision.hpp"
+
+namespace engine {
+	namespace navigation {
+		// Flags describing each navigation cell, cached in the chunks. 
+		enum CellFlags : std::uint8_t { 
+			Passable = 1 << 0, 
+			// Passable cell with room above it and a solid tile below it. 
+			Standable = 1 << 1 
+		};
+		// Ways a walking mob can move between standable cells. 
+		enum class EdgeType { Walk, Jump, Drop };
+
+		struct Waypoint {
+			gs::Vec2i cell; 
+			// How the cell is reached from the previous waypoint. 
+			EdgeType edgeType; 
+		};
+
+		constexpr int maxJumpHeight = 1; 
+		constexpr int maxDropHeight = 3; 
+		// How far horizontally a search may stray from it's start. 
+		constexpr int maxSearchWidth = 32; 
+		constexpr int maxNodesPerSearch = 1024; 
+		constexpr int maxSearchesPerTick = 2; 
+		// Number of ticks a path can be reused by other mobs, provided no 
+		// blocks along it have been edited. 
+		constexpr int sharedPathLifetime = 30; 
+		constexpr int maxSharedPaths = 8; 
+
+		std::uint8_t getCell(gs::Vec2i cell); 
+		bool isCellStandable(gs::Vec2i cell); 
+		// Cell the bottom of the entity is inside of. 
+		gs::Vec2i getFeetCell(const Entity& entity); 
+
+		// Resets the search budget, should be called once each tick. 
+		void beginTick(); 
+		// Finds a path of waypoints between two standable cells, or up to 
+		// the closest cell to the goal when it can't be reached. Paths found
+		// to the same goal are shared between mobs. Returns false if the 
+		// start isn't standable or the tick's search budget has run out. 
+		bool findPath(
+			gs::Vec2i start, gs::Vec2i goal, std::vector<Waypoint>& path
+		); 
+		void clearSharedPaths(); 
+	}
+}
\ No newline at end of file
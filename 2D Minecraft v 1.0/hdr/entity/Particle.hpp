@@ -4,9 +4,12 @@
 #include "../Resources.hpp"
 
 namespace engine {
+	// Describes a single particle when it's spawned. Stars are kept as 
+	// particles directly, while every other particle is copied into the 
+	// particle store. 
 	class Particle {
 	public:
-		enum class Type { Generic, Star, DamagePoint, End } type;
+		enum class Type { Generic, Star, End } type;
 		gs::Vec2f position; 
 		gs::Vec2f velocity; 
 		gs::Vec2f size; 
@@ -15,21 +18,19 @@ namespace engine {
 		float rotation; 
 		float rotationalSpeed; 
 		gs::Color color; 
-		std::string string; 
 		int timeRemaining; 
-		bool active; 
-		bool reserved; 
 
 		Particle(); 
 		Particle(Type type); 
 		~Particle() = default; 
 
 		void applyAcceleration(gs::Vec2f acceleration); 
+		// Only used for stars, the particle store updates all other 
+		// particles. 
 		void update(); 
 
-		static constexpr int numOfParticles = 1000; 
-		static const bool litParticles[static_cast<int>(Type::End)]; 
-		static const int numOfStars; 
+		static constexpr int numOfParticles = 8192; 
+		static constexpr int numOfStars = 200; 
 		static const float starLowerHorizon; 
 
 		static void generateBlockParticles(
@@ -46,10 +47,53 @@ namespace engine {
 		); 
 	};
 
-	extern Particle particles[Particle::numOfParticles]; 
+	// Stores each particle property in it's own array, so the simple 
+	// properties can be updated in tight loops over every particle. Live 
+	// particles are packed at the front of the arrays, leaving the free 
+	// slots as a stack at the back. 
+	struct ParticleStore {
+		float positionsX[Particle::numOfParticles]; 
+		float positionsY[Particle::numOfParticles]; 
+		float velocitiesX[Particle::numOfParticles]; 
+		float velocitiesY[Particle::numOfParticles]; 
+		float rotations[Particle::numOfParticles]; 
+		float rotationalSpeeds[Particle::numOfParticles]; 
+		// Maximum falling velocity of each particle, scaled by it's mass. 
+		float maxFallVelocities[Particle::numOfParticles]; 
+		// Fraction of horizontal velocity kept each tick. 
+		float dragScalers[Particle::numOfParticles]; 
+		// How quickly the particle fades when it's about to expire. 
+		int fadeRates[Particle::numOfParticles]; 
+		int timesRemaining[Particle::numOfParticles]; 
+		bool collisionEnabled[Particle::numOfParticles]; 
+		gs::Vec2f sizes[Particle::numOfParticles]; 
+		gs::Color colors[Particle::numOfParticles]; 
+		int numOfParticles = 0; 
+		// Number of particles which have collision enabled. 
+		int numOfColliding = 0; 
+
+		void add(const Particle& particle); 
+		void remove(int particleIndex); 
+		void clear(); 
+		void update(); 
+	}; 
+
+	// Floating damage numbers, kept apart from the particles since they 
+	// are few and carry their own text. 
+	struct DamageText {
+		std::string string; 
+		gs::Vec2f position; 
+		gs::Color color; 
+		int timeRemaining; 
+	};
+
+	extern ParticleStore particleStore; 
+	extern Particle stars[Particle::numOfStars]; 
+	extern std::vector<DamageText> damageTexts; 
 	extern int particlesRendered; 
 
 	void initStars(); 
 	void addParticle(const Particle& particle); 
+	void addDamageText(const std::string& string, gs::Vec2f position); 
 	void updateParticles(); 
 }
\ No newline at end of file
@@ -23,8 +23,10 @@ namespace engine {
 
 		void update() override; 
 		void hurt(int damage, bool playSound = true); 
+		bool isBurning() const; 
 
 		ItemContainer& getItemContainerSelected(); 
+		const ItemContainer& getItemContainerSelected() const; 
 		std::string getSaveString() const override; 
 
 		static const int maxHealth; 
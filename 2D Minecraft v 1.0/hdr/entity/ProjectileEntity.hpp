@@ -4,7 +4,7 @@
 #include "Gravity.hpp"
 
 namespace engine {
-	class ProjectileEntity : public Entity {
+	class ProjectileEntity final : public Entity {
 	public:
 		float angle; 
 		float speed; 
@@ -18,4 +18,7 @@ namespace engine {
 		void update() override; 
 	private:
 	};
+
+	extern EntityPool<ProjectileEntity> projectileEntities; 
+	extern EntityGrid<ProjectileEntity> projectileEntityGrid; 
 }
\ No newline at end of file
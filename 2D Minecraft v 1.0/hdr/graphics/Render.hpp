@@ -1,7 +1,10 @@
 #pragma once
 
 // Dependencies
+#include <unordered_map>
 #include "Window.hpp"
+#include "VertexArena.hpp"
+#include "../util/WorkerPool.hpp"
 #include "../world/World.hpp"
 #include "../entity/Player.hpp"
 #include "../entity/Mob.hpp"
@@ -14,7 +17,9 @@ namespace engine {
 	namespace render {
 		constexpr float tileSize = 16.0f; 
 		constexpr float maxCameraScale = 10.0f; 
-		constexpr float minCameraScale = 1.0f; 
+		constexpr float minCameraScale = 0.5f; 
+		// Below this scale chunks are drawn as one image each. 
+		constexpr float impostorCameraScale = 1.0f; 
 		const std::string assetDirectory = "assets/";
 
 		extern gs::Vec2f normalizedCameraPosition;
@@ -38,10 +43,45 @@ namespace engine {
 		);
 		const sf::Image& takeScreenshot(); 
 
-		constexpr int maxNumOfTiles = 15000; 
+		// Walls, blocks and foreground blocks. 
+		constexpr int numOfWorldLayers = 3; 
+
+		// Tile verticies of a chunk in chunk space, kept until the chunk 
+		// changes. 
+		struct ChunkMesh {
+			const Chunk* chunk; 
+			std::vector<sf::Vertex> tileVerticies
+				[numOfWorldLayers][Chunk::numOfMeshSections]; 
+			std::vector<sf::Vertex> tileOverlayVerticies
+				[numOfWorldLayers][Chunk::numOfMeshSections]; 
+			// One pixel per tile, used when zoomed far out. 
+			std::vector<sf::Uint8> impostorPixels; 
+			sf::Texture impostorTexture; 
+
+			ChunkMesh(); 
+			~ChunkMesh() = default; 
+		};
+
+		// Everything which decides what the sky layer looks like. 
+		struct BackgroundCacheKey {
+			int timeBucket; 
+			float cameraScale; 
+			bool layersRendered[2]; 
+
+			bool operator==(const BackgroundCacheKey& other) const = default; 
+		};
 
 		extern gs::Transition transition; 
 		extern sf::VertexArray skyBox; 
+		// The sky, stars, sun and moon, only redrawn when the cache key 
+		// changes. Biome backgrounds scroll with the player, so they're drawn
+		// over it each frame. 
+		extern sf::RenderTexture backgroundRenderTexture; 
+		extern sf::Sprite backgroundRenderTextureSprite; 
+		extern BackgroundCacheKey backgroundCacheKey; 
+		extern bool backgroundCached; 
+		// The sun moves about three pixels between redraws. 
+		constexpr int backgroundTicksPerBucket = 16; 
 		extern sf::RenderTexture worldRenderTexture; 
 		extern sf::Sprite worldRenderTextureSprite; 
 		extern bool shouldSunAndMoonBeRendered; 
@@ -60,19 +100,48 @@ namespace engine {
 		extern sf::Image blockAtlasImage, wallAtlasImage; 
 		extern sf::Texture blockOverlayAtlas; 
 		extern sf::Sprite blockSprite, wallSprite; 
-		extern sf::Vertex tileVerticies[maxNumOfTiles * 4]; 
-		extern sf::Vertex tileOverlayVerticies[maxNumOfTiles * 4]; 
-		extern int tileVertexIndex, tileOverlayVertexIndex; 
+		extern VertexArena tileVertexArena, tileOverlayVertexArena; 
+		// Chunks in view this frame, along with their meshes. 
+		extern std::vector<const Chunk*> visibleChunks; 
+		extern std::vector<ChunkMesh*> visibleChunkMeshes; 
+		// Start of each visible chunk's tile and overlay verticies. 
+		extern std::vector<gs::Vec2i> chunkVertexOffsets; 
+		extern std::vector<int> chunkLightVertexCounts; 
 		extern sf::RenderTexture lightMap; 
 		extern sf::Sprite lightMapSprite; 
-		extern sf::Vertex lightMapVerticies[maxNumOfTiles * 4]; 
-		extern int lightVertexIndex; 
+		extern VertexArena lightMapVertexArena; 
+		// One texel per tile, smoothed by bilinear filtering when scaled up. 
+		extern sf::Texture lightMapTexture; 
+		extern sf::Sprite lightMapTextureSprite; 
+		extern std::vector<sf::Uint8> lightMapPixels; 
+		extern gs::Vec2i lightMapPixelsSize; 
 		extern sf::Texture tileBreakingStageTextures[10]; 
 		extern sf::Sprite tileBreakingStageSprite; 
 		extern int tilesRendered; 
+		extern int tilesRebuilt; 
+		extern std::unordered_map<int, ChunkMesh> chunkMeshes; 
+		extern sf::Sprite impostorSprite; 
+		extern gs::Color blockImpostorColors[Block::End]; 
+		extern gs::Color wallImpostorColors[Wall::End]; 
 		extern sf::Texture entitySegmentTextures[Model::End]
 			[Model::Segment::maxNumOfSegments];
-		extern sf::Sprite entitySegmentSprite; 
+		// Item, block and wall atlases used for item icons. 
+		constexpr int numOfItemAtlases = 3; 
+		// Model segments and item icons packed together, so every entity can 
+		// be drawn at once. 
+		extern sf::Texture entityAtlas; 
+		extern sf::IntRect entitySegmentTextureBounds[Model::End]
+			[Model::Segment::maxNumOfSegments];
+		extern gs::Vec2i itemAtlasOffsets[numOfItemAtlases]; 
+		extern VertexArena entityVertexArena; 
+		extern VertexArena particleVertexArena, damageTextVertexArena; 
+		// Characters used by damage numbers, whose glyphs are cached. 
+		constexpr char damageTextCharacters[] = "0123456789-"; 
+		constexpr int numOfDamageTextGlyphs = sizeof(damageTextCharacters) - 1; 
+		constexpr int damageTextCharacterSize = 30; 
+		extern sf::Glyph damageTextGlyphs[numOfDamageTextGlyphs]; 
+		extern bool damageTextGlyphsCached; 
+		extern int drawCalls; 
 
 		void loadAssets(); 
 		void handleAssets(); 
@@ -85,38 +154,87 @@ namespace engine {
 		sf::IntRect generateTextureBounds(int textureIndex);
 		void applyTextureBounds(int textureIndex, sf::Sprite& sprite);
 		void applyTextureBounds(int textureIndex, sf::Vertex* quads, int angle = 0); 
+		void applyTextureBounds(sf::Vertex* quads, sf::IntRect bounds); 
 		void applyVertexBounds(sf::Vertex* quads, gs::Vec2f position, gs::Vec2f size); 
+		void applyVertexBounds(
+			sf::Vertex* quads, gs::Vec2f center, gs::Vec2f size, float rotation
+		); 
 		void resizeSpriteBounds(sf::Sprite& sprite); 
+		void createEntityAtlas(); 
+		sf::IntRect getItemTextureBounds(const Item& item); 
  
 		void updateBackground(); 
 
-		void renderSky(GameTime gameTime);
-		void renderBiomeBackground(); 
-		void renderStars(GameTime gameTime); 
-		void renderSunAndMoon(GameTime gameTime);
+		void updateSkyColors(GameTime gameTime); 
+		void renderSky(
+			GameTime gameTime, sf::RenderTarget& target = *window::winmain
+		);
+		float getBiomeBackgroundScale(); 
+		void renderBiomeBackground(sf::RenderTarget& target = *window::winmain); 
+		void renderStars(
+			GameTime gameTime, sf::RenderTarget& target = *window::winmain
+		); 
+		void renderSunAndMoon(
+			GameTime gameTime, sf::RenderTarget& target = *window::winmain
+		);
+		BackgroundCacheKey getBackgroundCacheKey(); 
 		void renderBackground(); 
-		void renderChunkLayer(const Chunk& chunk, int layerIndex); 
+		int buildChunkMeshSection(
+			const Chunk& chunk, ChunkMesh& chunkMesh, int sectionIndex
+		); 
+		gs::Vec2i getRenderableMeshSectionRange(); 
+		void buildVisibleChunkMeshes(const World& world); 
+		int getChunkLayerVertexCount(
+			const ChunkMesh& chunkMesh, int layerIndex, bool overlay
+		); 
+		void renderChunkLayer(
+			const ChunkMesh& chunkMesh, int chunkOffset, int layerIndex, 
+			bool overlay, sf::Vertex* verticies
+		); 
+		bool areImpostorsRendered(); 
+		void createImpostorColors(); 
+		void buildChunkImpostor(const Chunk& chunk, ChunkMesh& chunkMesh); 
+		void buildVisibleChunkImpostors(); 
+		void renderChunkImpostors(); 
 		void renderWalls(const World& world); 
 		void renderBlocks(const World& world); 
 		void renderFluids(const World& world); 
 		void renderWorldLayer(const World& world, int layerIndex); 
+		void addEntityQuad(
+			sf::IntRect textureBounds, gs::Vec2f position, gs::Vec2f origin, 
+			gs::Vec2f scale, float rotation, gs::Color color = gs::Color::White
+		); 
+		void flushEntityQuads(sf::RenderTarget& target); 
 		void renderEntitySegment(
 			const Entity& entity, int segmentIndex, int textureOffset = 0, 
-			bool flip = false, sf::RenderTarget& target = worldRenderTexture
+			bool flip = false
 		); 
 		void renderHeldItem(Entity& entity, Item item, ModelTransform::Segments segment);
 		void renderPlayerEntity(
 			Player& playerEntity, sf::RenderTarget& target = worldRenderTexture
 		);
 		void renderMobEntity(Mob& mobEntity); 
-		void renderItemEntity(const ItemEntity& itemEntity, bool applySin = true); 
+		void renderItemEntity(
+			const ItemEntity& itemEntity, bool applySin = true, 
+			gs::Vec2f flip = gs::Vec2f(1.0f, 1.0f), float rotation = 0.0f
+		); 
 		void renderProjectileEntity(const ProjectileEntity& projectileEntity); 
-		void renderEntity(const EntityPair& entity); 
 		void renderEntities(); 
-		void renderParticle(const Particle& particle);
+		void renderParticle(int particleIndex);
+		void renderStar(const Particle& star); 
+		void renderDamageText(const DamageText& damageText); 
+		void renderDamageText(
+			const std::string& string, gs::Vec2f position, float scale, 
+			gs::Color color
+		); 
+		void flushParticleQuads(sf::RenderTarget& target); 
 		void renderUnlitParticles(); 
 		void renderLitParticles();  
-		void renderChunkLightMap(const Chunk& chunk, const World& world); 
+		int renderChunkLightMap(
+			const Chunk& chunk, const World& world, sf::Vertex* verticies
+		); 
+		void fillChunkLightMapPixels(const Chunk& chunk, int pixelColumn); 
+		void renderLightMapTexture(const World& world); 
 		void renderWorldLightMap(const World& world); 
 		void finishWorldRendering(); 
 	}
@@ -18,6 +18,32 @@ namespace engine {
 				~RemappingButton() = default;
 			};
 
+			// Everything which changes how a string is laid out and colored. 
+			struct TextStyle {
+				const sf::Font* font; 
+				unsigned int characterSize; 
+				gs::Vec2f scale; 
+				gs::Color fillColor; 
+				float outlineThickness; 
+				gs::Color outlineColor; 
+
+				bool operator==(const TextStyle& other) const = default; 
+			};
+			// Glyph quads of a string, kept between frames until unused. 
+			struct RetainedText {
+				std::string string; 
+				TextStyle style; 
+				// Outline quads come before fill quads. 
+				std::vector<sf::Vertex> verticies; 
+				sf::FloatRect localBounds; 
+				int lastUsedTick; 
+			};
+			// String which is only formatted again once it's values change. 
+			struct CachedString {
+				std::string string; 
+				std::vector<double> values; 
+			};
+
 			constexpr int numOfFonts = 2; 
 			constexpr int numOfWidgetTextures = 5; 
 			constexpr int numOfRemappingButtons = 11; 
@@ -28,6 +54,9 @@ namespace engine {
 			extern gs::Color textBackgroundColor; 
 			extern bool textSharpen; 
 			extern sf::FloatRect prvsTextBounds; 
+			extern bool textShadow; 
+			extern std::unordered_map<std::size_t, RetainedText> retainedTexts; 
+			constexpr int maxNumOfRetainedTexts = 512; 
 			extern bool displayDebugMenu; 
 			extern bool hideUIMenu; 
 			extern std::string fpsString; 
@@ -56,6 +85,15 @@ namespace engine {
 				gs::Color backgroundColor = gs::Color::Transparent,
 				bool sharpen = false
 			);
+			void setTextShadow(bool shadow); 
+			void layoutRetainedText(RetainedText& retainedText); 
+			const RetainedText& getRetainedText(
+				const std::string& string, const TextStyle& style
+			); 
+			void renderRetainedText(
+				const std::string& string, gs::Vec2f position, bool centered, 
+				bool ignoreRendering
+			); 
 			void renderText(
 				const std::string& string, gs::Vec2f position, 
 				bool centered = false, bool ignoreRendering = false
@@ -213,6 +251,29 @@ namespace engine {
 			extern bool furnaceOutputSelected; 
 			extern int chestSlotSelected; 
 
+			constexpr int maxNumOfRegionSlots = Player::numOfInventorySlots; 
+
+			// Quads of a group of item slots, kept between frames and only
+			// rebuilt once one of the slots changes. 
+			struct RetainedSlotRegion {
+				enum Id {
+					Hotbar, Inventory, CraftingGrid, CraftingOutput, Container, 
+					End
+				};
+
+				// Copies of the slots the quads were built from. 
+				ItemContainer itemContainers[maxNumOfRegionSlots]; 
+				gs::Vec2f positions[maxNumOfRegionSlots]; 
+				int numOfSlots = 0; 
+				float guiScale = 0.0f; 
+				bool changed = true; 
+				std::vector<sf::Vertex> itemVerticies; 
+				std::vector<sf::Vertex> durabilityVerticies; 
+				std::vector<sf::Vertex> countVerticies; 
+			};
+
+			extern RetainedSlotRegion retainedSlotRegions[RetainedSlotRegion::End]; 
+
 			void loadAssets(); 
 			void handleAssets(); 
 			gs::Vec2f getWorldPreviewPosition(int worldPreviewIndex); 
@@ -233,9 +294,18 @@ namespace engine {
 				const Item& item, gs::Vec2f position, float size, 
 				sf::RenderTarget& target = *window::winmain
 			);
+			// Count shown on an item slot, padded to two characters. 
+			const std::string& getItemCountString(int count); 
 			void renderInventoryItem(
 				const ItemContainer& itemContainer, gs::Vec2f position
 			); 
+			void beginRetainedSlots(RetainedSlotRegion::Id regionId, int numOfSlots); 
+			void setRetainedSlot(
+				RetainedSlotRegion::Id regionId, int slotIndex, 
+				const ItemContainer& itemContainer, gs::Vec2f position
+			); 
+			void buildRetainedSlots(RetainedSlotRegion& region); 
+			void renderRetainedSlots(RetainedSlotRegion::Id regionId); 
 			void renderTextBox(const std::string& name, gs::Vec2f position); 
 
 			void updateLoadingScreen(); 
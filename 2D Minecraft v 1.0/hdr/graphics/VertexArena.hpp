@@ -0,0 +1,48 @@
+#pragma once
+
+// Dependencies
+#include "../Resources.hpp"
+
+namespace engine {
+	namespace render {
+		// Reusable vertex storage which grows as needed, and is cleared each
+		// frame without releasing memory. 
+		class VertexArena {
+		public:
+			// A range of verticies drawn together. 
+			struct Batch {
+				int start; 
+				int count; 
+			};
+
+			VertexArena(int initialCapacity = defaultCapacity); 
+			~VertexArena() = default; 
+
+			void clear(); 
+			sf::Vertex* allocate(int numOfVerticies); 
+			// Returns the most recently allocated verticies to the arena. 
+			void deallocate(int numOfVerticies); 
+			Batch beginBatch() const; 
+			void endBatch(Batch& batch) const; 
+			void draw(
+				sf::RenderTarget& target, Batch batch, 
+				const sf::RenderStates& states = sf::RenderStates::Default
+			); 
+
+			int getSize() const; 
+			int getCapacity() const; 
+			int getPeakSize() const; 
+			int getNumOfReallocations() const; 
+
+			static constexpr int defaultCapacity = 16384; 
+			// Streams verticies through a vertex buffer when supported. 
+			static bool useVertexBuffers; 
+		private:
+			std::vector<sf::Vertex> verticies; 
+			int size; 
+			int peakSize; 
+			int numOfReallocations; 
+			sf::VertexBuffer vertexBuffer; 
+		};
+	}
+}
\ No newline at end of file
@@ -14,6 +14,8 @@ namespace engine {
 					None,			Sunlight,
 					Furnace,		Lava
 				} id;
+				// What kind of entity carries the light, if any. 
+				enum class EntityBinding { None, Item, Burning } entityBinding; 
 
 				TileColor baseColor;
 				int strength; 
@@ -22,16 +24,37 @@ namespace engine {
 				float flickerFrequency; 
 				float flickerAmplitude; 
 				bool flickerMaintainCenter; 
+				int bindingItemId; 
 
 				Light(); 
 				~Light() = default; 
 
 				TileColor getColor(gs::Vec2i position) const; 
+				int getFlickerPhase(gs::Vec2i position) const; 
+				int getFalloffSize(bool smooth) const; 
+				// Returns the colors of each distance away from the light. 
+				const TileColor* getFalloff(bool smooth, int flickerPhase) const; 
+				void bakeFalloff(); 
+				bool isFalloffStale() const; 
 
 				static constexpr int numOfLights = 100; 
 				static Light lightSources[numOfLights]; 
 				static int maxLightRadius; 
+				static constexpr int numOfFlickerPhases = 16; 
+				// Geometry and Smooth falloff. 
+				static constexpr int numOfFalloffStyles = 2; 
+				static std::vector<Id> entityLights; 
+
+				static Id getEntityLight(
+					EntityBinding entityBinding, int itemId = 0
+				); 
 			private:
+				// Colors indexed by flicker phase, then distance. 
+				std::vector<TileColor> falloffTables[numOfFalloffStyles]; 
+				TileColor bakedColor; 
+
+				float getFlickerPercentage(float value) const; 
+				TileColor getUnflickeredColor() const; 
 			};
 			
 			void loadLights(); 
@@ -4,16 +4,38 @@
 #include "Light.hpp"
 #include "../Render.hpp"
 #include "../../world/World.hpp"
+#include "../../world/PathFinding.hpp"
 
 namespace engine {
 	namespace render {
 		namespace lighting {
-			enum class LightingStyle { Geometry, Smooth };
+			enum class LightingStyle { Geometry, Smooth, Texture, End };
 			constexpr int timeBetweenSpawnLightingUpdates = 120; 
+			constexpr int maxDynamicLightUpdatesPerTick = 8; 
+			constexpr int maxDirtyLightRegions = 16; 
+
+			// A light carried by an entity, which is moved without relighting
+			// the rest of the world. 
+			struct DynamicLight {
+				// The player is identified by it's type alone. 
+				Entity::Type entityType; 
+				EntityHandle entityHandle; 
+				Light::Id lightId; 
+				gs::Vec2i position; 
+				Light::Id targetLightId; 
+				gs::Vec2i targetPosition; 
+				bool applied; 
+				bool bound; 
+			};
 
 			extern int lightUpdateRate;
-			extern bool forceLights;
+			// Areas of tiles which need relighting, after their emission or 
+			// opacity changed. 
+			extern std::vector<sf::IntRect> dirtyLightRegions; 
+			extern int dirtyLightArea; 
 			extern std::vector<std::pair<Light::Id, gs::Vec2i>> lights; 
+			extern const std::string lightingStyleNames[
+				static_cast<int>(LightingStyle::End)]; 
 			extern TileColor ambientLightColor;
 			extern TileColor sunlightColor; 
 			extern TileColor moonlightColor;
@@ -23,14 +45,39 @@ namespace engine {
 			extern bool fullBrightEnabled; 
 			extern int ticksUntilNextLightingUpdate;
 			extern int ticksUntilNextSpawningLightingUpdate;
+			// Light colors covering the mob spawning area. 
+			extern std::vector<TileColor> spawningLightColors; 
+			extern gs::Vec2i spawningLightOrigin; 
+			extern gs::Vec2i spawningLightSize; 
+			extern std::vector<DynamicLight> dynamicLights; 
+			// Tile colors from before any dynamic lights were applied. 
+			extern std::unordered_map<gs::Vec2i, TileColor, HashContainer> 
+				staticTileColors; 
+			extern int dynamicLightUpdates; 
 
 			bool isValidLight(gs::Vec2i position, Light::Id lightId); 
+			void cycleLightingStyle(); 
 			TileColor maximizeColors(TileColor color0, TileColor color1); 
 			bool colorGreaterThan(TileColor color0, TileColor color1); 
+			Light::Id getBlockLightId(Block block); 
+			Light::Id getTileLightId(gs::Vec2i position); 
+			void markLightingDirty(sf::IntRect region); 
+			void markLightingDirty(gs::Vec2i position); 
+			void relightRegion(const sf::IntRect& region, World& world); 
 			void applyLight(const Light& lightSource, gs::Vec2i position, World& world);
 			void attemptLight(gs::Vec2i	position);
+			Light::Id getEntityLightId(const Player& playerEntity); 
+			Light::Id getEntityLightId(const Mob& mobEntity); 
+			Light::Id getEntityLightId(const ItemEntity& itemEntity); 
+			void applyDynamicLight(const DynamicLight& dynamicLight, World& world); 
+			void removeDynamicLight(const DynamicLight& dynamicLight, World& world); 
+			void updateDynamicLights(World& world); 
 			void updateWorldLights(World& world);
-			void updateSpawningLights(World& world); 
+			TileColor getSpawningLightColor(gs::Vec2i position); 
+			TileColor getSpawningLightColor(int xpos, int ypos); 
+			void applySpawningLightColor(const Light& lightSource, gs::Vec2i position); 
+			void resetSpawningLightColors(); 
+			void updateSpawningLightColors(); 
 		}
 	}
 }
\ No newline at end of file
@@ -13,6 +13,11 @@ namespace engine {
 		const std::string& filename, char seperator = '=',
 		const std::string& end = "End", bool removeSpaces = true
 	);
+	// Same as loadPairedFile, for contents which have already been read. 
+	const PairVector& loadPairedStream(
+		std::istream& istream, char seperator = '=',
+		const std::string& end = "End", bool removeSpaces = true
+	);
 	void savePairedFile(
 		const std::string& filename, const PairVector& pairs, 
 		char seperator = '='
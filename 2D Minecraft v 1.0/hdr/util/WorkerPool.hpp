@@ -0,0 +1,48 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include "../Resources.hpp"
+
+namespace engine {
+	// Small pool of threads used to split independent work across cores. 
+	class WorkerPool {
+	public:
+		WorkerPool(int numOfWorkers = getDefaultNumOfWorkers()); 
+		~WorkerPool(); 
+
+		// Calls the task once for each index in [0, count), returning once all 
+		// have finished. The calling thread takes part in the work as well. 
+		void parallelFor(int count, const std::function<void(int)>& task); 
+
+		int getNumOfWorkers() const; 
+
+		static int getDefaultNumOfWorkers(); 
+
+		static constexpr int maxNumOfWorkers = 7; 
+	private:
+		// Workers are started on first use, rather than during static 
+		// initialization. 
+		void startWorkers(); 
+		void work(); 
+		void runTasks(); 
+
+		std::vector<std::thread> workers; 
+		int numOfWorkers; 
+		std::mutex mutex; 
+		std::condition_variable tasksAvailable, tasksFinished; 
+		const std::function<void(int)>* task; 
+		int taskCount; 
+		std::atomic<int> nextTaskIndex; 
+		int numOfActiveWorkers; 
+		unsigned int generation; 
+		bool stopping; 
+	};
+
+	extern WorkerPool workerPool; 
+}
\ No newline at end of file
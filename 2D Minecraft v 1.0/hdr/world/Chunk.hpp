@@ -1,6 +1,7 @@
 #pragma once
 
 // Dependencies
+#include <bitset>
 #include "Tile.hpp"
 #include "TileEntity.hpp"
 #include "Biome.hpp"
@@ -12,6 +13,8 @@ namespace engine {
 		int offset; 
 		bool loadedFromSave; 
 		bool needsToBeSaved; 
+		// Hash of the chunk's entity file when it was loaded. 
+		size_t entityFileHash; 
 
 		Chunk(); 
 		Chunk(int offset); 
@@ -42,6 +45,8 @@ namespace engine {
 
 		Block getBlock(gs::Vec2i postion) const; 
 		Block getBlock(int xpos, int ypos) const;
+		// Writes through the reference don't invalidate any caches, so 
+		// visible changes must be followed by invalidateBlockChanges. 
 		Block& getBlockRef(gs::Vec2i position);
 		Block& getBlockRef(int xpos, int ypos);
 		Block::Id getBlockId(gs::Vec2i position) const; 
@@ -60,14 +65,45 @@ namespace engine {
 		Biome getBiome() const; 
 		Biome::Id getBiomeId() const; 
 
+		bool isMeshSectionBuilt(int sectionIndex) const; 
+		// The render mesh is a cache, so it's state can change on a const chunk. 
+		void setMeshSectionBuilt(int sectionIndex, bool built) const; 
+		bool isImpostorBuilt() const; 
+		void setImpostorBuilt(bool built) const; 
+		void invalidateMesh(gs::Vec2i position); 
+		// Invalidates the caches affected by how the block has changed, 
+		// ignoring changes to properties which aren't visible. 
+		void invalidateBlockChanges(gs::Vec2i position, Block prvsBlock); 
+		// Navigation cells are also a cache, built a column at a time. 
+		std::uint8_t getNavigationCell(int xpos, int ypos) const; 
+		void setNavigationCell(int xpos, int ypos, std::uint8_t cell) const; 
+		bool isNavigationColumnBuilt(int xpos) const; 
+		void setNavigationColumnBuilt(int xpos, bool built) const; 
+		// Called when a block changes, for the caches built from blocks. 
+		void invalidateBlockCaches(gs::Vec2i position); 
+		// Changes whenever a block in the chunk is edited, or the chunk is 
+		// recreated. 
+		unsigned int getBlockEditStamp() const; 
+
 		static constexpr int width = 16;
 		static constexpr int height = 512;  
+		static constexpr int meshSectionHeight = 16; 
+		static constexpr int numOfMeshSections = height / meshSectionHeight; 
 	private:
 		Block blocks[width][height]; 
 		Wall walls[width][height]; 
 		std::vector<TileEntity> tileEntities; 
 		TileColor tileColors[width][height]; 
 		Biome biome; 
+		mutable std::bitset<numOfMeshSections> meshSectionsBuilt; 
+		mutable bool impostorBuilt = false; 
+		mutable std::uint8_t navigationCells[width][height]; 
+		mutable std::bitset<width> navigationColumnsBuilt; 
+		// Bumped whenever a tile's solidity, collision or lava changes, as 
+		// line of sight and navigation only depend on those. 
+		unsigned int blockEditStamp = ++numOfBlockEdits; 
+
+		static unsigned int numOfBlockEdits; 
 
 		void clear();
 	};
@@ -1,7 +1,6 @@
 #pragma once
 
 // Dependencies
-#include <queue>
 #include <unordered_map>
 
 #include "World.hpp"
@@ -31,18 +30,32 @@ namespace engine {
 		const std::vector<gs::Vec2i>& getSearchedBlocks() const; 
 		bool wereChunkBoundsReached() const; 
 	private:
-		std::queue<gs::Vec2i> frontier; 
-		std::vector<gs::Vec2i> searched; 
-		std::unordered_map<gs::Vec2i, gs::Vec2i, HashContainer> pathMap; 
 		bool(*safeBlockFilter)(Block block);
 		bool(*unsafeBlockFilter)(Block block); 
+		// Area the search can cover, from the restrictions or the limit. 
+		sf::IntRect searchRegion; 
+		// Index of the next searched block to flood from, the blocks after
+		// it make up the frontier. 
+		int frontierIndex; 
 		bool boundsReached; 
 		bool endPointReached; 
 
+		// Search state is shared by every path finder on a thread, so it's 
+		// only allocated until it has grown large enough. Blocks are 
+		// indexed by their position in the search region, and are only 
+		// visited when their stamp matches the current search. 
+		static thread_local std::vector<gs::Vec2i> searched; 
+		static thread_local std::vector<int> visitStamps; 
+		static thread_local std::vector<int> parentIndices; 
+		static thread_local int searchStamp; 
+
 		bool isPositionWithinBounds(gs::Vec2i position) const; 
+		int getRegionIndex(gs::Vec2i position) const; 
+		gs::Vec2i getRegionPosition(int regionIndex) const; 
 
 		void clearSearch(); 
-		void initSearch(); 
+		void initSearch(int limit); 
+		void visit(gs::Vec2i position, int parentIndex); 
 		bool breadthFlood(); 
 	};
 }
\ No newline at end of file
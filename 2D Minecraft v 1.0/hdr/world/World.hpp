@@ -1,6 +1,8 @@
 #pragma once
 
 // Dependencies
+#include <sstream>
+
 #include "Chunk.hpp"
 #include "GameTime.hpp"
 #include "../inventory/LootTable.hpp"
@@ -114,8 +116,11 @@ namespace engine {
 
 		Block getBlock(gs::Vec2i position) const; 
 		Block getBlock(int xpos, int ypos) const;
+		// Visible changes made through the reference must be followed by 
+		// invalidateBlockChanges. 
 		Block& getBlockRef(gs::Vec2i position); 
 		Block& getBlockRef(int xpos, int ypos); 
+		void invalidateBlockChanges(gs::Vec2i position, Block prvsBlock); 
 		Block::Id getBlockId(gs::Vec2i position) const;
 		Block::Id getBlockId(int xpos, int ypos) const; 
 		Wall getWall(gs::Vec2i position) const;
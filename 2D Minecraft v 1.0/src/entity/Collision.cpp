@@ -21,42 +21,6 @@ namespace engine {
 			blockInsideOf = gs::Vec2i(-1, -1); 
 		}
 
-		bool floor(const Entity& entity, gs::Vec2f position, gs::Vec2f size) {
-			const gs::Vec2f halfEntitySize = entity.size * 0.5f; 
-
-			return
-				entity.position.x + halfEntitySize.x > position.x
-				&& entity.position.x - halfEntitySize.x < position.x + size.x
-				&& entity.position.y + halfEntitySize.y >= position.y - entity.velocity.y
-				&& entity.position.y + halfEntitySize.y <= position.y + size.y; 
-		}
-		bool ceil(const Entity& entity, gs::Vec2f position, gs::Vec2f size) {
-			const gs::Vec2f halfEntitySize = entity.size * 0.5f; 
-
-			return
-				entity.position.x + halfEntitySize.x > position.x
-				&& entity.position.x - halfEntitySize.x < position.x + size.x
-				&& entity.position.y - halfEntitySize.y <= position.y - entity.velocity.y
-				&& entity.position.y - halfEntitySize.y >= position.y - size.y; 
-		}
-		bool leftWall(const Entity& entity, gs::Vec2f position, gs::Vec2f size) {
-			const gs::Vec2f halfEntitySize = entity.size * 0.5f; 
-
-			return
-				entity.position.x - halfEntitySize.x <= position.x - entity.velocity.x
-				&& entity.position.x - halfEntitySize.x >= position.x - size.x
-				&& entity.position.y + halfEntitySize.y > position.y
-				&& entity.position.y - halfEntitySize.y < position.y + size.y; 
-		}
-		bool rightWall(const Entity& entity, gs::Vec2f position, gs::Vec2f size) {
-			const gs::Vec2f halfEntitySize = entity.size * 0.5f; 
-
-			return
-				entity.position.x + halfEntitySize.x >= position.x - entity.velocity.x
-				&& entity.position.x + halfEntitySize.x <= position.x + size.x
-				&& entity.position.y + halfEntitySize.y > position.y
-				&& entity.position.y - halfEntitySize.y < position.y + size.y; 
-		}
 		bool intersect(const Entity& entity1, const Entity& entity2, 
 			float tolerance) 
 		{
@@ -88,165 +52,319 @@ namespace engine {
 				* multiplier;
 		}
 		bool doEntitiesHaveEyeSight(const Entity& entity1, const Entity& entity2) {
-			const float offsetTolerance = 0.05f;
+			gs::Vec2i startTile = gs::Vec2i(
+				std::floor(entity1.position.x), std::floor(entity1.position.y)
+			); 
+			gs::Vec2i endTile = gs::Vec2i(
+				std::floor(entity2.position.x), std::floor(entity2.position.y)
+			); 
 
-			float deltaX = entity1.position.x - entity2.position.x; 
+			// Orders the tiles so both directions share a result. 
+			if (endTile.x < startTile.x 
+				|| (endTile.x == startTile.x && endTile.y < startTile.y))
+				std::swap(startTile, endTile); 
 
-			if (std::abs(deltaX) < offsetTolerance)
-				return true; 
+			const unsigned int blockEditStamps = 
+				getBlockEditStamps(startTile.x, endTile.x); 
+			const size_t queryIndex = (HashContainer()(startTile) 
+				^ (HashContainer()(endTile) * 31)) % eyeSightQueryCacheSize; 
+			EyeSightQuery& eyeSightQuery = eyeSightQueries[queryIndex]; 
 
-			const float entityEyeSightSlope = 
-				(entity1.position.y - entity2.position.y) / deltaX; 
+			if (!eyeSightQuery.valid || eyeSightQuery.startTile != startTile
+				|| eyeSightQuery.endTile != endTile
+				|| eyeSightQuery.blockEditStamps != blockEditStamps)
+			{
+				eyeSightQuery = { 
+					startTile, endTile, blockEditStamps, true, 
+					isLineOfSightClear(startTile, endTile)
+				}; 
+			}
 
-			float tracingSpeed = 0.5f * -gs::util::sign(deltaX); 
+			return eyeSightQuery.clear; 
+		}
+		bool isLineOfSightClear(gs::Vec2i startTile, gs::Vec2i endTile) {
+			const gs::Vec2i delta = endTile - startTile; 
+			const gs::Vec2i step = gs::Vec2i(
+				delta.x > 0 ? 1 : -1, delta.y > 0 ? 1 : -1
+			); 
+			const int numOfSteps = std::abs(delta.x) + std::abs(delta.y); 
+			// Fractions of the line between crossing tile edges. 
+			const float edgeDistanceX = delta.x != 0 
+				? 1.0f / std::abs(delta.x) : std::numeric_limits<float>::max(); 
+			const float edgeDistanceY = delta.y != 0 
+				? 1.0f / std::abs(delta.y) : std::numeric_limits<float>::max(); 
 
-			for (gs::Vec2f tracingPosition = entity1.position; 
-				std::abs(deltaX) > offsetTolerance;
-				tracingPosition += gs::Vec2f(tracingSpeed, tracingSpeed
-					* entityEyeSightSlope))
-			{
-				deltaX = entity1.position.x - entity2.position.x; 
+			// The line runs between tile centers, so it's halfway to the 
+			// first edges. 
+			float nextEdgeX = edgeDistanceX * 0.5f; 
+			float nextEdgeY = edgeDistanceY * 0.5f; 
+			gs::Vec2i tile = startTile; 
 
-				if (std::abs(deltaX) < std::abs(tracingSpeed))
-					tracingSpeed = deltaX; 
+			// Visits every tile the line passes through, besides the two 
+			// tiles it connects. 
+			for (int stepIndex = 1; stepIndex < numOfSteps; stepIndex++) {
+				if (nextEdgeX < nextEdgeY) {
+					tile.x += step.x; 
+					nextEdgeX += edgeDistanceX; 
+				}
+				else {
+					tile.y += step.y; 
+					nextEdgeY += edgeDistanceY; 
+				}
 
-				if (world->getBlock(gs::Vec2i(tracingPosition)).isSolid()) 
+				if (world->getBlock(tile).isSolid())
 					return false; 
 			}
 
 			return true; 
 		}
 
-		void applyCollision(Entity& entity, const World& world, bool applyForward) {
-			auto constrainYpos = [](int ypos) -> int {
-				return gs::util::clamp(ypos, 0, Chunk::height);
-			}; 
+		EyeSightQuery eyeSightQueries[eyeSightQueryCacheSize]; 
 
-			const gs::Vec2i collisionRange = gs::Vec2i(
-				std::ceil(entity.size.x / 2.0f) + 2, 
-				std::ceil(entity.size.y / 2.0f) + 2
-			);
-			const float pixelWidth = 1.0f / 16.0f; 
-			const gs::Vec2i entityPosition = gs::Vec2i(entity.position); 
-			const gs::Vec2f halfEntitySize = entity.size * 0.5f; 
+		unsigned int getBlockEditStamps(int startXpos, int endXpos) {
+			unsigned int blockEditStamps = 0; 
+
+			for (int chunkOffset = World::getChunkOffset(startXpos); 
+				chunkOffset <= World::getChunkOffset(endXpos); chunkOffset++) 
+			{
+				const Chunk* chunk = world->getChunk(chunkOffset); 
+
+				if (chunk != nullptr)
+					blockEditStamps += chunk->getBlockEditStamp(); 
+			}
 
-			entity.collisions.clear(); 
-			entity.velocityScaler = gs::Vec2f(1.0f, 1.0f); 
+			return blockEditStamps; 
+		}
+
+		TileCollision tileCollisions[BlockInfo::numOfBlocks]; 
+
+		void loadTileCollisions() {
+			for (int blockId = 0; blockId < BlockInfo::numOfBlocks; blockId++) {
+				const BlockInfo& blockInfo = BlockInfo::blockInfo[blockId]; 
+
+				tileCollisions[blockId].collisionType = 
+					static_cast<CollisionType>(
+						blockInfo.getVar(BlockInfo::collisionType)); 
+				tileCollisions[blockId].floorOffset = 
+					static_cast<BlockInfo::BlockUpdate>(
+						blockInfo.getVar(BlockInfo::blockUpdate))
+					== BlockInfo::BlockUpdate::FarmLand ? 1.0f / 16.0f : 0.0f; 
+			}
+		}
+		void applyCollision(Hitbox& hitbox, const World& world) {
+			const float pixelWidth = 1.0f / 16.0f; 
+			// How far a hitbox can sink into a tile and still be pushed back
+			// out of it. 
+			const float penetrationDepth = 0.5f; 
+			const float maxFluidLevel = 7.0f;
+			const float maxFluidFallVelocity = 0.08f;
 
-			gs::Vec2i tilePosition; 
+			Collisions& collisions = hitbox.collisions; 
+			gs::Vec2f& position = hitbox.position; 
+			gs::Vec2f& velocity = hitbox.velocity; 
+			const gs::Vec2f halfSize = hitbox.size * 0.5f; 
+			const TileCollision emptyTile = { CollisionType::Empty, 0.0f }; 
 
-			for (tilePosition.x = applyForward ? entityPosition.x 
-				- collisionRange.x : entityPosition.x + collisionRange.x; 
-				applyForward ? tilePosition.x < entityPosition.x 
-				+ collisionRange.x : tilePosition.x > entityPosition.x 
-				- collisionRange.x; tilePosition.x += applyForward ? 1 : -1)
+			auto getTileCollision = [&](int xpos, int ypos, Block& block) 
+				-> const TileCollision& 
 			{
-				for (tilePosition.y = constrainYpos(entityPosition.y
-					- collisionRange.y); tilePosition.y < constrainYpos(
-						entityPosition.y + collisionRange.y); tilePosition.y++)
-				{
-					const Block block = world.getBlock(tilePosition); 
-					const gs::Vec2f position = gs::Vec2f(tilePosition); 
+				if (ypos < 0 || ypos >= Chunk::height)
+					return emptyTile; 
+
+				block = world.getBlock(gs::Vec2i(xpos, ypos)); 
+
+				// Most tiles passed are air, so they're skipped first. 
+				if (block.id <= Block::Air || block.tags.ignoreCollision)
+					return emptyTile; 
 
-					if (block.tags.ignoreCollision)
+				return tileCollisions[block.id]; 
+			}; 
+			// Columns and rows the hitbox currently overlaps. 
+			auto getFirstColumn = [&]() -> int {
+				return std::floor(position.x - halfSize.x); 
+			}; 
+			auto getLastColumn = [&]() -> int {
+				return std::ceil(position.x + halfSize.x) - 1; 
+			}; 
+
+			collisions.clear(); 
+			hitbox.velocityScaler = gs::Vec2f(1.0f, 1.0f); 
+
+			Block block; 
+			const float bottom = position.y + halfSize.y; 
+			const float verticalMotion = velocity.y * hitbox.physicsTicks; 
+
+			// Slows down the hitbox if it's bottom is inside of a fluid. 
+			for (int xpos = getFirstColumn(); xpos <= getLastColumn(); xpos++) {
+				for (int ypos = std::floor(bottom) - 1; ypos <= std::floor(
+					bottom + std::max(verticalMotion, 0.0f)); ypos++) 
+				{
+					if (getTileCollision(xpos, ypos, block).collisionType 
+						!= CollisionType::Fluid)
 						continue; 
 
-					switch (static_cast<CollisionType>(block.getVar(
-						BlockInfo::collisionType)))
+					const float fluidHeight = 1.0f - (block.tags.fluidLevel
+						/ (maxFluidLevel + 1.0f)); 
+					const float fluidSurface = ypos + 1.0f - fluidHeight; 
+
+					if (bottom >= fluidSurface - velocity.y 
+						&& bottom <= ypos + 1.0f) 
 					{
-					case CollisionType::Block:
+						velocity.y = std::min(velocity.y, maxFluidFallVelocity);
+						hitbox.velocityScaler = gs::Vec2f(0.65f, 0.5f);
+						collisions.insideFluid = true;
+						// Stops entity from taking fall damage in fluids. 
+						collisions.distanceFallen = 0.0f;
+
+						if (block.id == Block::Water)
+							collisions.insideWater = true; 
+						else if (block.id == Block::Lava)
+							collisions.insideLava = true;
+					}
+				}
+			}
+
+			// Sweeps vertically, visiting the closest rows first. 
+			if (velocity.y > 0.0f) {
+				const float sweptMotion = velocity.y * hitbox.physicsTicks; 
+				bool hit = false; 
+
+				for (int ypos = std::floor(bottom - penetrationDepth 
+					- pixelWidth); ypos <= std::floor(bottom + sweptMotion) 
+						&& !hit; ypos++)
+				{
+					for (int xpos = getFirstColumn(); xpos <= getLastColumn(); 
+						xpos++) 
 					{
-						const float floorOffset =
-							static_cast<BlockInfo::BlockUpdate>(block.getVar(
-								BlockInfo::blockUpdate))
-							== BlockInfo::BlockUpdate::FarmLand ? 1.0f
-								/ 16.0f : 0.0f;
-
-						if (entity.velocity.y > 0.0f &&
-							floor(entity, position + gs::Vec2f(0.0f, floorOffset),
-								gs::Vec2f(1.0f, 0.5f)))
-						{
-							entity.position.y = tilePosition.y 
-								- halfEntitySize.y + floorOffset;
-							entity.velocity.y = 0.0f;
-							entity.collisions.floor = true;
-							entity.collisions.blockInsideOf = tilePosition; 
-							entity.collisions.floorTile = tilePosition;
-						}
-						else if (entity.velocity.y < 0.0f && ceil(entity,
-							position + gs::Vec2f(0.0f, 1.0f),
-							gs::Vec2f(1.0f, 0.5f)))
-						{
-							entity.position.y = tilePosition.y + 1.0f
-								+ halfEntitySize.y;
-							entity.velocity.y = 0.0f;
-							entity.collisions.ceil = true;
-							entity.collisions.blockInsideOf = tilePosition;
-						}
-						if (entity.velocity.x < 0.0f && leftWall(entity,
-							position + gs::Vec2f(1.0f, pixelWidth + floorOffset),
-							gs::Vec2f(0.5f, 1.0f - pixelWidth - floorOffset)))
-						{
-							entity.position.x = tilePosition.x + 1.0f
-								+ halfEntitySize.x;
-							entity.velocity.x = 0.0f;
-							entity.collisions.leftWall = true;
-							entity.collisions.blockInsideOf = tilePosition;
-						}
-						else if (entity.velocity.x > 0.0f && rightWall(entity,
-							position + gs::Vec2f(0.0f, pixelWidth + floorOffset), 
-							gs::Vec2f(0.5f, 1.0f - pixelWidth - floorOffset)))
+						const TileCollision& tileCollision = 
+							getTileCollision(xpos, ypos, block); 
+						const float surface = ypos + tileCollision.floorOffset; 
+
+						if (tileCollision.collisionType == CollisionType::Block
+							&& bottom >= surface - sweptMotion 
+							&& bottom <= surface + penetrationDepth)
 						{
-							entity.position.x = tilePosition.x
-								- halfEntitySize.x;
-							entity.velocity.x = 0.0f;
-							entity.collisions.rightWall = true;
-							entity.collisions.blockInsideOf = tilePosition;
+							position.y = surface - halfSize.y; 
+							velocity.y = 0.0f; 
+							collisions.floor = true; 
+							collisions.blockInsideOf = gs::Vec2i(xpos, ypos); 
+							collisions.floorTile = gs::Vec2i(xpos, ypos); 
+							hit = true; 
+							break; 
 						}
 					}
-						break;
-					case CollisionType::Fluid:
+				}
+			}
+			else if (velocity.y < 0.0f) {
+				const float top = position.y - halfSize.y; 
+				const float sweptMotion = -velocity.y * hitbox.physicsTicks; 
+				bool hit = false; 
+
+				for (int ypos = std::floor(top - penetrationDepth); ypos >= 
+					std::ceil(top - sweptMotion - 1.0f) && !hit; ypos--)
+				{
+					for (int xpos = getFirstColumn(); xpos <= getLastColumn(); 
+						xpos++) 
 					{
-						const float maxFluidLevel = 7.0f;
-						const float fluidLevel = block.tags.fluidLevel;
-						const gs::Vec2f collisionSize = gs::Vec2f(
-							1.0f, 1.0f - (fluidLevel / (maxFluidLevel + 1.0f))
-						);
-						const float maxFluidFallVelocity = 0.08f;
-
-						if (floor(entity, position + gs::Vec2f(0.0f, 1.0f
-							- collisionSize.y), collisionSize))
+						const float tileBottom = ypos + 1.0f; 
+
+						if (getTileCollision(xpos, ypos, block).collisionType 
+							== CollisionType::Block
+							&& top <= tileBottom + sweptMotion 
+							&& top >= tileBottom - penetrationDepth)
 						{
-							entity.velocity.y = std::min(
-								entity.velocity.y, maxFluidFallVelocity
-							);
-							entity.velocityScaler = gs::Vec2f(0.65f, 0.5f);
-							entity.collisions.insideFluid = true;
-							// Stops entity from taking fall damage in fluids. 
-							entity.collisions.distanceFallen = 0.0f;
-
-							if (block.id == Block::Water)
-								entity.collisions.insideWater = true; 
-							else if (block.id == Block::Lava)
-								entity.collisions.insideLava = true;
+							position.y = tileBottom + halfSize.y; 
+							velocity.y = 0.0f; 
+							collisions.ceil = true; 
+							collisions.blockInsideOf = gs::Vec2i(xpos, ypos); 
+							hit = true; 
+							break; 
+						}
+					}
+				}
+			}
+
+			const float top = position.y - halfSize.y; 
+			const float sweptBottom = position.y + halfSize.y; 
+			// Rows a wall could be in, ignoring the floor being stood on. 
+			const int firstRow = std::floor(top); 
+			const int lastRow = std::ceil(sweptBottom - pixelWidth) - 1; 
+
+			// Checks if the tile blocks the hitbox from the side. 
+			auto isWall = [&](int xpos, int ypos) -> bool {
+				const TileCollision& tileCollision = 
+					getTileCollision(xpos, ypos, block); 
+
+				return tileCollision.collisionType == CollisionType::Block
+					&& sweptBottom > ypos + pixelWidth 
+						+ tileCollision.floorOffset
+					&& top < ypos + 1.0f; 
+			}; 
+
+			// Sweeps horizontally, visiting the closest columns first. 
+			if (velocity.x < 0.0f) {
+				const float left = position.x - halfSize.x; 
+				const float sweptMotion = -velocity.x * hitbox.physicsTicks; 
+				bool hit = false; 
+
+				for (int xpos = std::floor(left - penetrationDepth); xpos >= 
+					std::ceil(left - sweptMotion - 1.0f) && !hit; xpos--) 
+				{
+					const float tileRight = xpos + 1.0f; 
+
+					if (left > tileRight + sweptMotion 
+						|| left < tileRight - penetrationDepth)
+						continue; 
+
+					for (int ypos = firstRow; ypos <= lastRow; ypos++) {
+						if (isWall(xpos, ypos)) {
+							position.x = tileRight + halfSize.x; 
+							velocity.x = 0.0f; 
+							collisions.leftWall = true; 
+							collisions.blockInsideOf = gs::Vec2i(xpos, ypos); 
+							hit = true; 
+							break; 
 						}
 					}
-						break;
+				}
+			}
+			else if (velocity.x > 0.0f) {
+				const float right = position.x + halfSize.x; 
+				const float sweptMotion = velocity.x * hitbox.physicsTicks; 
+				bool hit = false; 
+
+				for (int xpos = std::ceil(right - penetrationDepth); xpos <= 
+					std::floor(right + sweptMotion) && !hit; xpos++) 
+				{
+					if (right < xpos - sweptMotion 
+						|| right > xpos + penetrationDepth)
+						continue; 
+
+					for (int ypos = firstRow; ypos <= lastRow; ypos++) {
+						if (isWall(xpos, ypos)) {
+							position.x = xpos - halfSize.x; 
+							velocity.x = 0.0f; 
+							collisions.rightWall = true; 
+							collisions.blockInsideOf = gs::Vec2i(xpos, ypos); 
+							hit = true; 
+							break; 
+						}
 					}
 				}
 			}
 		}
-		void applyCollision(Particle& particle, const World& world, bool applyForward) {
-			Entity hitboxEntity; 
-
-			hitboxEntity.position = particle.position; 
-			hitboxEntity.velocity = particle.velocity; 
-			hitboxEntity.size = particle.size; 
+		void applyCollision(Entity& entity, const World& world) {
+			Hitbox hitbox = { 
+				entity.position, entity.velocity, entity.size, 
+				entity.velocityScaler, entity.physicsTicks, entity.collisions 
+			}; 
 
-			applyCollision(hitboxEntity, world, applyForward); 
+			applyCollision(hitbox, world); 
 
-			particle.position = hitboxEntity.position; 
-			particle.velocity = hitboxEntity.velocity; 
+			entity.position = hitbox.position; 
+			entity.velocity = hitbox.velocity; 
+			entity.velocityScaler = hitbox.velocityScaler; 
+			entity.collisions = hitbox.collisions; 
 		}
 		void attract(Entity& planetEntity, Entity& moonEntity, bool planetFixed) {
 			const gs::Vec2f bodyDelta = planetEntity.position - moonEntity.position; 
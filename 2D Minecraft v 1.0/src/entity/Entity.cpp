@@ -11,12 +11,14 @@ namespace engine {
 		size({ 1.0f, 1.0f }),
 		mass(1.0f),
 		immunityFrames(0), 
-		dead(false)
+		dead(false), 
+		updateTier(UpdateTier::Full), 
+		ticksSinceUpdate(0), 
+		updateTicks(1), 
+		physicsTicks(1)
 	{
-		numOfEntities++; 
 	}
 	Entity::~Entity() {
-		numOfEntities--; 
 	}
 
 	void Entity::update() {
@@ -32,161 +34,278 @@ namespace engine {
 			"\nmass = " + toString(mass);
 	}
 
-	int Entity::numOfEntities = 0;
-
 	void Entity::updatePosition() {
-		position.x += velocity.x * velocityScaler.x;
-		position.y += velocity.y * velocityScaler.y; 
-		collisions.distanceWalked += std::abs(velocity.x); 
+		position.x += velocity.x * velocityScaler.x * physicsTicks;
+		position.y += velocity.y * velocityScaler.y * physicsTicks; 
+		collisions.distanceWalked += std::abs(velocity.x) * physicsTicks; 
 	}
 
-	std::vector<EntityPair> entities;
+	int entityUpdateTierCounts[static_cast<int>(UpdateTier::End)]; 
+
+	int getNumOfEntities() {
+		return (player != nullptr ? 1 : 0) + mobs.size() + itemEntities.size()
+			+ projectileEntities.size(); 
+	}
+	bool scheduleEntityUpdate(Entity& entity, bool canSleep) {
+		auto countTier = [&](UpdateTier updateTier) {
+			entity.updateTier = updateTier; 
+			entityUpdateTierCounts[static_cast<int>(updateTier)]++; 
+		}; 
+
+		entity.ticksSinceUpdate++; 
+
+		if (entity.updateTier == UpdateTier::Sleeping) {
+			// Sleeping entities are woken by anything moving them, by losing 
+			// the block they rest on, or once they've slept long enough. 
+			if (canSleep && entity.velocity == gs::Vec2f()
+				&& world->getBlock(entity.collisions.floorTile).isSolid()
+				&& entity.ticksSinceUpdate < maxTicksAsleep)
+			{
+				countTier(UpdateTier::Sleeping); 
+				return false; 
+			}
 
-	void addEntity(Entity::Type type, Entity* entity) {
-		switch (type) {
-		case Entity::Type::Mob:
-			dynamic_cast<Mob*>(entity)->init();
-			break; 
+			// Time spent resting doesn't need any movement applied. 
+			countTier(UpdateTier::Full); 
+			entity.updateTicks = entity.ticksSinceUpdate; 
+			entity.physicsTicks = 1; 
+			entity.ticksSinceUpdate = 0; 
+
+			return true; 
 		}
 
-		entities.push_back(EntityPair(type, entity)); 
+		const float playerDistance = gs::util::distance(
+			entity.position, player->position); 
+		const float reducedUpdateStep = std::max(std::abs(entity.velocity.x),
+			std::abs(entity.velocity.y)) * reducedUpdateInterval; 
+
+		if (playerDistance > frozenUpdateDistance) {
+			// Frozen entities don't catch up on the time they missed. 
+			countTier(UpdateTier::Frozen); 
+			entity.ticksSinceUpdate = 0; 
+
+			return false; 
+		}
+		if (canSleep) {
+			countTier(UpdateTier::Sleeping); 
+			entity.velocity = gs::Vec2f(); 
+			entity.ticksSinceUpdate = 0; 
+
+			return false; 
+		}
+		if (playerDistance > reducedUpdateDistance 
+			&& reducedUpdateStep < maxReducedUpdateStep) 
+		{
+			countTier(UpdateTier::Reduced); 
+
+			if (entity.ticksSinceUpdate < reducedUpdateInterval)
+				return false; 
+		}
+		else 
+			countTier(UpdateTier::Full); 
+
+		entity.updateTicks = entity.ticksSinceUpdate; 
+		entity.physicsTicks = entity.ticksSinceUpdate; 
+		entity.ticksSinceUpdate = 0; 
+
+		return true; 
 	}
 	void updateEntities() {
+		// Entities are stored in the grids by their center, so areas around 
+		// the player are padded to cover the size of the entities. 
+		const gs::Vec2f queryPadding = gs::Vec2f(1.0f, 1.0f); 
+
+		static std::vector<EntityHandle> projectilesHittingPlayer; 
 		audio::SoundEvent::Id playerInteractionSoundEvent = 
 			audio::SoundEvent::None;
 
-		for (int entityPairIndex = 0; entityPairIndex < entities.size();
-			entityPairIndex++) 
-		{
-			const EntityPair& entityPair = entities[entityPairIndex];
+		for (int& updateTierCount : entityUpdateTierCounts)
+			updateTierCount = 0; 
+
+		player->update(); 
+		navigation::beginTick(); 
 
-			Entity::Type entityType = entityPair.first; 
-			Entity* entity = entityPair.second; 
+		// Entities are removed by swapping the last entity of their pool into
+		// their place, so the index only advances past living entities. 
+		for (int mobIndex = 0; mobIndex < mobs.size();) {
+			Mob& mobEntity = mobs[mobIndex]; 
 
-			entity->update(); 
+			if (scheduleEntityUpdate(mobEntity, mobEntity.isIdle())) {
+				mobEntity.update(); 
+				mobGrid.update(mobIndex); 
+			}
 
 			const gs::Vec2f playerEntityDelta = player->position 
-				- entity->position;
+				- mobEntity.position;
 			const float distance = std::sqrt(
 				std::pow(playerEntityDelta.x, 2) 
 					+ std::pow(playerEntityDelta.y, 2)
 			);
+			gs::Vec2f mouseLocation = mouseTileLocation; 
 
-			switch (entityType) {
-			case Entity::Type::ItemEntity:
+			if (mouseLocation.x < 0.0f)
+				mouseLocation.x += 1.0f; 
+
+			if (collision::intersect(mobEntity, mouseLocation, 0.1f) 
+				&& !render::ui::gameOver) 
 			{
-				ItemEntity* itemEntity = dynamic_cast<ItemEntity*>(entity); 
+				player->interactionLocked = true;
+
+				if (gs::input::mouseClickL) {
+					if (distance < Player::maxReachDistance) {
+						const ItemContainer& itemContainerSelected = 
+							player->getItemContainerSelected();
+						const int damage = itemContainerSelected.item.isEmpty() ? 1 
+							: itemContainerSelected.item.getVar(ItemInfo::damage); 
+						const int prvsMobHealth = mobEntity.health; 
+
+						mobEntity.hurt(damage);
+						mobEntity.velocity = -collision::calculateKnockback(
+							playerEntityDelta
+						); 
 
-				if (itemEntity->timeLeft < ItemEntity::defaultNumberOfTicksAlive 
-					&& collision::intersect(*player, *itemEntity, 0.5f)
-					&& !render::ui::gameOver) 
-				{
-					itemEntity->itemContainer = addItemToInventory(
-						itemEntity->itemContainer, player->inventory, 
-						Player::numOfInventorySlots
-					); 
-					audio::SoundEvent::soundEvents[audio::SoundEvent::Pop].
-						playSoundEvent(audio::SoundEvent::EventType::ItemPickup); 
+						if (mobEntity.health < prvsMobHealth) {
+							addDamageText(std::to_string(damage), 
+								mouseLocation - gs::Vec2f(0.0f, 0.5f)); 
+						}
+					}
 				}
 			}
-				break; 
-			case Entity::Type::Mob:
+
+			if (collision::intersect(mobEntity, *player)
+				&& !render::ui::gameOver) 
 			{
-				Mob* mobEntity = dynamic_cast<Mob*>(entity); 
-				gs::Vec2f mouseLocation = mouseTileLocation; 
+				if (mobEntity.behavior == Mob::Behavior::Hostile) {
+					const float mobMeleeDamage = 
+						Mob::mobMeleeDamage[mobEntity.type]; 
 
-				if (mouseLocation.x < 0.0f)
-					mouseLocation.x += 1.0f; 
+					player->hurt(mobMeleeDamage); 
+					player->velocity = collision::calculateKnockback(
+						playerEntityDelta
+					); 
+				}
+			}
 
-				if (collision::intersect(*mobEntity, mouseLocation, 0.1f) 
-					&& !render::ui::gameOver) 
-				{
-					player->interactionLocked = true;
-
-					if (gs::input::mouseClickL) {
-						if (distance < Player::maxReachDistance) {
-							const ItemContainer& itemContainerSelected = 
-								player->getItemContainerSelected();
-							const int damage = itemContainerSelected.item.isEmpty() ? 1 
-								: itemContainerSelected.item.getVar(ItemInfo::damage); 
-							const int prvsMobHealth = mobEntity->health; 
-
-							mobEntity->hurt(damage);
-							mobEntity->velocity = -collision::calculateKnockback(
-								playerEntityDelta
-							); 
-
-							if (mobEntity->health < prvsMobHealth) {
-								Particle damageParticle(Particle::Type::DamagePoint);
-
-								damageParticle.position = mouseLocation
-									- gs::Vec2f(0.0f, 0.5f);
-								damageParticle.string = std::to_string(damage);
-
-								addParticle(damageParticle);
-							}
-						}
-					}
+			if (mobEntity.dead) {
+				const LootTable::Id lootTableId = 
+					Mob::mobLootIds[mobEntity.type]; 
+
+				if (lootTableId != LootTable::None) {
+					ItemContainer generatedItemContainer; 
+
+					do {
+						generatedItemContainer = 
+							LootTable::lootTables[lootTableId].getLoot();
+
+						ItemEntity::dropItemEntity(
+							generatedItemContainer, mobEntity.position
+						);
+					} 
+					while (!generatedItemContainer.item.isEmpty()); 
 				}
 
-				if (collision::intersect(*mobEntity, *player)
-					&& !render::ui::gameOver) 
-				{
-					if (mobEntity->behavior == Mob::Behavior::Hostile) {
-						const float mobMeleeDamage = 
-							Mob::mobMeleeDamage[mobEntity->type]; 
+				removeMob(mobIndex); 
+			}
+			else 
+				mobIndex++; 
+		}
 
-						player->hurt(mobMeleeDamage); 
-						player->velocity = collision::calculateKnockback(
-							playerEntityDelta
-						); 
-					}
+		if (ItemEntity::ticksUntilNextItemMerging <= 0) {
+			ItemEntity::mergeItemEntities(); 
+			ItemEntity::ticksUntilNextItemMerging = 
+				ItemEntity::ticksBetweenItemMerging; 
+		}
+		else 
+			ItemEntity::ticksUntilNextItemMerging--; 
+
+		// Only item entities near the player are attracted to it. 
+		if (!render::ui::gameOver) {
+			itemEntityGrid.forEachInRadius(player->position, 
+				ItemEntity::maximumItemPickupDistance, 
+				[](ItemEntity& itemEntity) {
+					collision::attract(*player, itemEntity); 
 				}
+			); 
+		}
 
-				if (mobEntity->dead) {
-					const LootTable::Id lootTableId = 
-						Mob::mobLootIds[mobEntity->type]; 
+		for (int itemEntityIndex = 0; itemEntityIndex < itemEntities.size();) {
+			ItemEntity& itemEntity = itemEntities[itemEntityIndex]; 
 
-					if (lootTableId != LootTable::None) {
-						ItemContainer generatedItemContainer; 
+			if (scheduleEntityUpdate(itemEntity, itemEntity.isResting()))
+				itemEntity.update(); 
 
-						do {
-							generatedItemContainer = 
-								LootTable::lootTables[lootTableId].getLoot();
+			if (itemEntity.dead)
+				itemEntityGrid.remove(itemEntityIndex); 
+			else {
+				itemEntityGrid.update(itemEntityIndex); 
+				itemEntityIndex++; 
+			}
+		}
 
-							ItemEntity::dropItemEntity(
-								generatedItemContainer, mobEntity->position
-							);
-						} 
-						while (!generatedItemContainer.item.isEmpty()); 
+		if (!render::ui::gameOver) {
+			itemEntityGrid.forEachInArea(
+				player->position - (player->size / 2.0f) - queryPadding, 
+				player->position + (player->size / 2.0f) + queryPadding, 
+				[](ItemEntity& itemEntity) {
+					if (itemEntity.pickupDelay == 0
+						&& collision::intersect(*player, itemEntity, 0.5f)) 
+					{
+						itemEntity.itemContainer = addItemToInventory(
+							itemEntity.itemContainer, player->inventory, 
+							Player::numOfInventorySlots
+						); 
+						audio::SoundEvent::soundEvents[audio::SoundEvent::Pop].
+							playSoundEvent(
+								audio::SoundEvent::EventType::ItemPickup); 
 					}
 				}
+			); 
+		}
+
+		for (int projectileEntityIndex = 0; 
+			projectileEntityIndex < projectileEntities.size();) 
+		{
+			ProjectileEntity& projectileEntity = 
+				projectileEntities[projectileEntityIndex]; 
+
+			if (scheduleEntityUpdate(projectileEntity))
+				projectileEntity.update(); 
+
+			if (projectileEntity.dead)
+				projectileEntityGrid.remove(projectileEntityIndex); 
+			else {
+				projectileEntityGrid.update(projectileEntityIndex); 
+				projectileEntityIndex++; 
 			}
-				break; 
-			case Entity::Type::ProjectileEntity:
-			{
-				ProjectileEntity* projectileEntity = 
-					dynamic_cast<ProjectileEntity*>(entity); 
+		}
 
-				if (collision::intersect(*player, *projectileEntity)
-					&& !projectileEntity->stuckInBlock) {
-					projectileEntity->dead = true; 
-					player->hurt(4); 
-					player->velocity = collision::calculateKnockback(
-						playerEntityDelta
-					);
-					audio::SoundEvent::soundEvents[audio::SoundEvent::ArrowHit]
-						.playSoundEvent(audio::SoundEvent::EventType::Generic);
+		// Projectiles which hit the player are removed after the query, as 
+		// the grid can't change during one. 
+		projectilesHittingPlayer.clear(); 
+		projectileEntityGrid.forEachInArea(
+			player->position - (player->size / 2.0f) - queryPadding, 
+			player->position + (player->size / 2.0f) + queryPadding, 
+			[](ProjectileEntity& projectileEntity) {
+				if (collision::intersect(*player, projectileEntity)
+					&& !projectileEntity.stuckInBlock) 
+				{
+					projectilesHittingPlayer.push_back(
+						projectileEntities.getHandle(projectileEntity)); 
 				}
 			}
-				break; 
-			}
+		); 
 
-			if (entity->dead) {
-				delete entity; 
-				entities.erase(entities.begin() + entityPairIndex); 
-				entityPairIndex--; 
-			}
+		for (EntityHandle projectileHandle : projectilesHittingPlayer) {
+			const ProjectileEntity& projectileEntity = 
+				*projectileEntities.get(projectileHandle); 
+
+			player->hurt(4); 
+			player->velocity = collision::calculateKnockback(
+				player->position - projectileEntity.position
+			);
+			audio::SoundEvent::soundEvents[audio::SoundEvent::ArrowHit]
+				.playSoundEvent(audio::SoundEvent::EventType::Generic);
+			projectileEntityGrid.remove(projectileHandle); 
 		}
 
 		//if (playerInteractionSoundEvent == audio::SoundEvent::None 
@@ -202,13 +321,14 @@ namespace engine {
 			&& world->gameTime.gameTicks < 20000; 
 	}
 	void deleteEntities() {
-		for (auto& entityPair : entities) {
-			Entity::Type entityType = entityPair.first;
-			Entity* entity = entityPair.second;
-
-			delete entity; 
-		}
-
-		entities.clear(); 
+		delete player; 
+		player = nullptr; 
+
+		mobGrid.clear(); 
+		navigation::clearSharedPaths(); 
+		Mob::numOfHostileMobs = 0; 
+		Mob::numOfPassiveMobs = 0; 
+		itemEntityGrid.clear(); 
+		projectileEntityGrid.clear(); 
 	}
 }
\ No newline at end of file
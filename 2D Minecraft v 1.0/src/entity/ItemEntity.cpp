@@ -7,7 +7,9 @@
 namespace engine {
 	ItemEntity::ItemEntity() :
 		Entity::Entity(),
-		timeLeft(defaultNumberOfTicksAlive)
+		timeLeft(defaultNumberOfTicksAlive), 
+		// Can't be picked up until it has been updated once. 
+		pickupDelay(1)
 	{
 		// Makes item spring in each direction. 
 		velocity.x = (static_cast<float>(randomGenerator.generate() % 100) 
@@ -23,16 +25,13 @@ namespace engine {
 		applyGravity(*this); 
 
 		gs::util::approach(&velocity.x, 0.0f, 20.0f);
-		if (collision::calculateEntityDistance(*player, *this) < 
-				maximumItemPickupDistance
-				&& !render::ui::gameOver)
-			collision::attract(*player, *this); 
 
 		collision::applyCollision(*this, *world); 
 		updatePosition(); 
 
 		dead = timeLeft <= 0; 
-		timeLeft--; 
+		timeLeft -= updateTicks; 
+		pickupDelay = std::max(pickupDelay - updateTicks, 0); 
 
 		if (itemContainer.count == 0)
 			dead = true; 
@@ -40,6 +39,12 @@ namespace engine {
 		//std::cout << (int)itemContainer.item.id << "\n"; 
 	}
 
+	bool ItemEntity::isResting() const {
+		return collisions.floor && !collisions.insideFluid
+			&& std::abs(velocity.x) < restingVelocity
+			&& itemContainer.count > 0; 
+	}
+
 	std::string ItemEntity::getSaveString() const {
 		std::string saveString = Entity::getSaveString();
 
@@ -63,18 +68,64 @@ namespace engine {
 		if (itemContainer.item.isEmpty())
 			return; 
 
-		ItemEntity* itemEntity = new ItemEntity(); 
+		ItemEntity itemEntity; 
 
-		itemEntity->position = position; 
-		itemEntity->itemContainer = itemContainer; 
+		itemEntity.position = position; 
+		itemEntity.itemContainer = itemContainer; 
 
 		if (velocity != gs::Vec2f(-1, -1))
-			itemEntity->velocity = velocity; 
+			itemEntity.velocity = velocity; 
 		if (preventPickup)
-			itemEntity->timeLeft += 60; 
+			itemEntity.pickupDelay = 60; 
 
-		addEntity(Type::ItemEntity, itemEntity);
+		itemEntityGrid.add(itemEntity); 
+	}
+
+	void ItemEntity::mergeItemEntities() {
+		for (ItemEntity& itemEntity : itemEntities) {
+			ItemContainer& itemContainer = itemEntity.itemContainer; 
+			const int stackSize = ItemInfo::itemInfo[itemContainer.item.id]
+				.getVar(ItemInfo::stackSize); 
+
+			// Item entities waiting to be picked up aren't merged, so the 
+			// delay isn't passed on to the rest of the stack. 
+			if (itemContainer.count == 0 || itemContainer.count >= stackSize
+				|| itemEntity.pickupDelay > 0)
+				continue; 
+
+			itemEntityGrid.forEachInRadius(itemEntity.position, 
+				itemMergingDistance, [&](ItemEntity& otherItemEntity) {
+					ItemContainer& otherItemContainer = 
+						otherItemEntity.itemContainer; 
+
+					if (&otherItemEntity == &itemEntity 
+						|| otherItemContainer.count == 0
+						|| otherItemEntity.pickupDelay > 0
+						|| !Item::compare(itemContainer.item, 
+							otherItemContainer.item)
+						|| itemContainer.item.tags.asInt 
+							!= otherItemContainer.item.tags.asInt)
+						return; 
+
+					const int itemsToMerge = std::min(
+						stackSize - itemContainer.count, 
+						otherItemContainer.count
+					); 
+
+					itemContainer.count += itemsToMerge; 
+					otherItemContainer.count -= itemsToMerge; 
+					// Keeps the older despawn time, so stacks which keep 
+					// being fed still despawn. 
+					itemEntity.timeLeft = std::min(
+						itemEntity.timeLeft, otherItemEntity.timeLeft); 
+				}
+			); 
+		}
 	}
 
 	const int ItemEntity::defaultNumberOfTicksAlive = 60 * 60 * 5;
+	int ItemEntity::ticksUntilNextItemMerging = 0; 
+
+	EntityPool<ItemEntity> itemEntities; 
+	EntityGrid<ItemEntity> itemEntityGrid(itemEntities); 
 }
\ No newline at end of file
@@ -17,7 +17,9 @@ namespace engine {
 		burningTicks(0), 
 		timeSinceLastAmbientSoundEvent(0),
 		skeletonShootingCooldown(0), 
-		creeperDetonationTicks(0)
+		creeperDetonationTicks(0),
+		pathIndex(0),
+		ticksUntilPathing(0)
 	{
 	}
 	Mob::Mob(Mob::Type mobType) : Mob() {
@@ -25,8 +27,6 @@ namespace engine {
 		init(); 
 	}
 	Mob::~Mob() {
-		if (behavior == Behavior::Hostile) numOfHostileMobs--;
-		else numOfPassiveMobs--;
 	}
 
 	void Mob::init() {
@@ -38,11 +38,10 @@ namespace engine {
 		else numOfPassiveMobs++; 
 	}
 	void Mob::update() {
-		const float targetDeltaThreshold = 0.1f; 
-		const float jumpVerticalVelocity = -0.22f; 
 		const gs::Vec2f maxPlayerTargetingDelta = gs::Vec2f(30.0f, 10.0f); 
 		const int averageAmbientSoundEventFrequency = 60 * 3; 
 		const int ambientSoundEventCooldown = 60; 
+		const int burnInterval = 60; 
 
 		const audio::SoundEvent::Id ambientSoundEvent = mobAmbientSoundEvents[type]; 
 		const gs::Vec2f mobPlayerDelta = gs::Vec2f(
@@ -52,11 +51,18 @@ namespace engine {
 		
 		mobPlayerDistance = gs::util::distance(gs::Vec2f(), mobPlayerDelta); 
 
+		// Mobs can skip ticks, so checks whether the burning ticks covered 
+		// by this update pass a multiple of the burn interval. 
+		auto reachesBurnInterval = [&]() {
+			return burningTicks / burnInterval 
+				!= std::max(burningTicks - updateTicks, 0) / burnInterval; 
+		}; 
+
 		// Handle ambient sound events. 
 		if (ambientSoundEvent != audio::SoundEvent::None
 			&& timeSinceLastAmbientSoundEvent == 0) 
 		{
-			if (randomGenerator.generate() % averageAmbientSoundEventFrequency == 0) {
+			if (rollChance(averageAmbientSoundEventFrequency)) {
 				audio::SoundEvent::soundEvents[ambientSoundEvent]
 					.playSoundEvent(audio::SoundEvent::EventType::MobAmbience, 
 						mobPlayerDistance);
@@ -78,7 +84,7 @@ namespace engine {
 			horizontalSpeed = 0.03f;
 
 			if (targetingPlayer) {
-				targetXpos = player->position.x;
+				navigateTo(*player); 
 				horizontalSpeed = 0.04f;
 
 				if (mobPlayerDelta.x > maxPlayerTargetingDelta.x
@@ -86,16 +92,18 @@ namespace engine {
 					|| randomGenerator.generate() % 600 == 0)
 				{
 					targetingPlayer = false;
+					path.clear(); 
+					ticksUntilPathing = 0; 
 				}
 			}
 			else if (mobPlayerDelta.x < maxPlayerTargetingDelta.x
 				&& mobPlayerDelta.y < maxPlayerTargetingDelta.y
-				&& randomGenerator.generate() % playerTargetingChange == 0)
-				//&& collision::doEntitiesHaveEyeSight(*this, *player))
+				&& randomGenerator.generate() % playerTargetingChange == 0
+				&& collision::doEntitiesHaveEyeSight(*this, *player))
 			{
 				targetingPlayer = true;
 			}
-			else if (randomGenerator.generate() % 300 == 0)
+			else if (rollChance(300))
 				targetXpos = position.x + (randomGenerator.generate() % 50) 
 					- 25;
 		}
@@ -103,32 +111,35 @@ namespace engine {
 		case Skeleton:
 			horizontalSpeed = 0.05f;
 
-			if (randomGenerator.generate() % 300 == 0)
+			if (rollChance(300))
 				targetXpos = position.x + (randomGenerator.generate() % 50) 
 					- 25;
 
-			if (skeletonShootingCooldown == 0 && mobPlayerDistance < 15.0f) {
+			if (skeletonShootingCooldown == 0 && mobPlayerDistance < 15.0f
+				&& collision::doEntitiesHaveEyeSight(*this, *player)) 
+			{
 				skeletonShootingCooldown = 180; 
 
-				ProjectileEntity* arrow = new ProjectileEntity(); 
+				ProjectileEntity arrow; 
 
-				arrow->position = position + gs::Vec2f(
+				arrow.position = position + gs::Vec2f(
 					1.0f * (modelTransform.facingForward ? 1.0f : -1.0f), 
 					-0.5f
 				); 
-				arrow->angle = gs::util::angleBetween(
+				arrow.angle = gs::util::angleBetween(
 					position, player->position
 				);
-				arrow->angle += arrow->angle > 270 ? -8.0f : 8.0f; 
+				arrow.angle += arrow.angle > 270 ? -8.0f : 8.0f; 
+
+				projectileEntityGrid.add(arrow); 
 
-				addEntity(Entity::Type::ProjectileEntity, arrow); 
 				audio::SoundEvent::soundEvents[audio::SoundEvent::ArrowShoot]
 					.playSoundEvent(audio::SoundEvent::EventType::Generic,
 						mobPlayerDistance);
 			} 
 
 			skeletonShootingCooldown = std::max(
-				skeletonShootingCooldown - 1, 0
+				skeletonShootingCooldown - updateTicks, 0
 			); 
 
 			break; 
@@ -138,7 +149,7 @@ namespace engine {
 
 			horizontalSpeed = 0.03f;
 
-			if (randomGenerator.generate() % 300 == 0)
+			if (rollChance(300))
 				targetXpos = position.x + (randomGenerator.generate() % 50)
 					- 25;
 
@@ -147,7 +158,7 @@ namespace engine {
 
 				if (creeperDetonationTicks == 0)
 					creeperDetonationTicks = maxCreeperDetonationTicks;
-				else if (creeperDetonationTicks == 1) {
+				else if (creeperDetonationTicks <= updateTicks) {
 					player->hurt(std::max(std::pow(creeperExplosionRadius, 2.0f) 
 						- ((mobPlayerDistance - 1.0f) * creeperExplosionRadius), 0.0f));
 					dead = true;
@@ -161,7 +172,10 @@ namespace engine {
 							mobPlayerDistance);
 				}
 
-				creeperDetonationTicks--;
+				// Stops at one so it always detonates on the next update. 
+				creeperDetonationTicks = std::max(
+					creeperDetonationTicks - updateTicks, 1
+				);
 				velocity.x = 0.0f;  
 				horizontalSpeed = 0.0f; 
 				modelTransform.setColor(gs::util::approach(
@@ -177,20 +191,21 @@ namespace engine {
 			break; 
 		case Type::Pig:
 			horizontalSpeed = 0.02f; 
-			if (randomGenerator.generate() % 300 == 0)
+			if (rollChance(300))
 				targetXpos = position.x 
 					+ (randomGenerator.generate(false) % 20); 
 			break; 
 		case Type::Cow:
 			horizontalSpeed = 0.02f;
-			if (randomGenerator.generate() % 300 == 0)
+			if (rollChance(300))
 				targetXpos = position.x
 					+ (randomGenerator.generate(false) % 20);
 			break; 
 		}
 
 		if (behavior == Behavior::Hostile && mobUndead[type]
-			&& burnUndeadHostileMobs && burningTicks % 60 == 0)
+			&& burnUndeadHostileMobs 
+			&& (burningTicks == 0 || reachesBurnInterval()))
 		{
 			if (world->isBlockExposedToSky(gs::Vec2i(position)) 
 					&& !collisions.insideWater) 
@@ -253,15 +268,15 @@ namespace engine {
 			collisions.distanceFallen = 0.0f; 
 		}
 		else
-			collisions.distanceFallen += velocity.y;
+			collisions.distanceFallen += velocity.y * physicsTicks;
 
 		if (collisions.insideLava) {
-			if (burningTicks % 60 == 0)
+			if (burningTicks == 0 || reachesBurnInterval())
 				burningTicks = 180;
 		}
 
 		if (burningTicks > 0) {
-			if (burningTicks % 60 == 0)
+			if (reachesBurnInterval())
 				hurt(collisions.insideLava ? 7 : 1);
 
 			modelTransform.setColor(gs::Color(255, 127, 0));
@@ -273,14 +288,16 @@ namespace engine {
 		if (health == 0)
 			dead = true; 
 
-		collision::applyCollision(*this, *world, velocity.x < 0.0f);
+		collision::applyCollision(*this, *world);
 		updatePosition();
 
-		immunityFrames = std::max(immunityFrames - 1, 0);
+		immunityFrames = std::max(immunityFrames - updateTicks, 0);
 		prvsPosition = position; 
 		modelTransform.update(*this);
-		burningTicks = std::max(burningTicks - 1, 0);
-		timeSinceLastAmbientSoundEvent = std::max(timeSinceLastAmbientSoundEvent - 1, 0);
+		burningTicks = std::max(burningTicks - updateTicks, 0);
+		timeSinceLastAmbientSoundEvent = std::max(
+			timeSinceLastAmbientSoundEvent - updateTicks, 0
+		);
 	}
 	void Mob::hurt(int damage) {
 		if (damage > 0 && immunityFrames == 0) {
@@ -304,6 +321,16 @@ namespace engine {
 		}
 	}
 
+	bool Mob::isIdle() const {
+		return behavior == Behavior::Passive && collisions.floor 
+			&& !collisions.insideFluid && burningTicks == 0 
+			&& immunityFrames == 0 && std::abs(velocity.x) < 0.001f
+			&& std::abs(targetXpos - position.x) <= targetDeltaThreshold; 
+	}
+	bool Mob::isBurning() const {
+		return burningTicks > 0; 
+	}
+
 	std::string Mob::getSaveString() const {
 		std::string saveString = Entity::getSaveString();
 
@@ -369,10 +396,77 @@ namespace engine {
 		audio::SoundEvent::CreeperDeath, audio::SoundEvent::PigDeath,
 		audio::SoundEvent::CowAmbient
 	}; 
+	void Mob::navigateTo(const Entity& targetEntity) {
+		// Number of waypoints ahead checked for being reached, as mobs can 
+		// pass through several in one update. 
+		const int waypointLookahead = 4; 
+		const gs::Vec2i feetCell = navigation::getFeetCell(*this); 
+
+		ticksUntilPathing -= updateTicks; 
+
+		if (ticksUntilPathing <= 0 && collisions.floor) {
+			// Searches are deferred once the tick's budget has run out, 
+			// keeping the old path until then. 
+			if (navigation::findPath(feetCell, 
+				navigation::getFeetCell(targetEntity), path)) 
+			{
+				pathIndex = 0; 
+				ticksUntilPathing = ticksBetweenPathing; 
+			}
+		}
+
+		for (int waypointIndex = pathIndex; waypointIndex < std::min(
+			pathIndex + waypointLookahead, static_cast<int>(path.size())); 
+			waypointIndex++) 
+		{
+			if (path[waypointIndex].cell == feetCell) {
+				pathIndex = waypointIndex + 1; 
+				break; 
+			}
+		}
+
+		if (pathIndex >= path.size()) {
+			targetXpos = targetEntity.position.x; 
+			return; 
+		}
+
+		const navigation::Waypoint& waypoint = path[pathIndex]; 
+
+		// The world has changed under the path. 
+		if (!navigation::isCellStandable(waypoint.cell))
+			ticksUntilPathing = 0; 
+
+		targetXpos = waypoint.cell.x + 0.5f; 
+
+		if (waypoint.edgeType == navigation::EdgeType::Jump 
+			&& collisions.floor && std::abs(targetXpos - position.x) < 1.0f)
+		{
+			velocity.y = jumpVerticalVelocity; 
+		}
+	}
+	bool Mob::rollChance(int averageTicks) const {
+		// Updates covering several ticks are more likely to succeed, so the 
+		// chance per tick stays the same. 
+		return randomGenerator.generate() 
+			% std::max(averageTicks / updateTicks, 1) == 0; 
+	}
+
 	const int Mob::hostileMobSpawnCap = 30, 
 		Mob::passiveMobSpawnCap = 8;
 	const int Mob::hostileMobUnloadDistance = World::chunkLoadDistance * Chunk::width; 
 	int Mob::numOfHostileMobs = 0, 
 		Mob::numOfPassiveMobs = 0;
 	bool Mob::burnUndeadHostileMobs = false; 
+
+	EntityPool<Mob> mobs; 
+	EntityGrid<Mob> mobGrid(mobs); 
+
+	void removeMob(int mobIndex) {
+		if (mobs[mobIndex].behavior == Mob::Behavior::Hostile) 
+			Mob::numOfHostileMobs--;
+		else 
+			Mob::numOfPassiveMobs--;
+
+		mobGrid.remove(mobIndex); 
+	}
 }
\ No newline at end of file
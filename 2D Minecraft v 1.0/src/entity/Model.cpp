@@ -57,7 +57,7 @@ namespace engine {
 			break; 
 		case Model::Player:
 		{
-			const Player* playerEntity = dynamic_cast<const Player*>(&entity); 
+			const Player* playerEntity = static_cast<const Player*>(&entity); 
 
 			float frontLegAngle = getLegWalkingAngle(); 
 			float backLegAngle = -frontLegAngle;
@@ -86,8 +86,6 @@ namespace engine {
 			break; 
 		case Model::Zombie:
 		{
-			const Mob* mobEntity = dynamic_cast<const Mob*>(&entity); 
-
 			float frontLegAngle = getLegWalkingAngle();
 			float backLegAngle = -frontLegAngle;
 			float frontArmAngle = getArmWalkingAngle();
@@ -108,8 +106,6 @@ namespace engine {
 			break; 
 		case Model::Skeleton: 
 		{
-			const Mob* mobEntity = dynamic_cast<const Mob*>(&entity);
-			
 			float frontLegAngle = getLegWalkingAngle() * 0.5f;
 			float backLegAngle = -frontLegAngle;
 			float frontArmAngle = (90.0f + getArmWalkingAngle()) * -scaler;
@@ -127,8 +123,6 @@ namespace engine {
 			break; 
 		case Model::Creeper:
 		{
-			const Mob* mobEntity = dynamic_cast<const Mob*>(&entity); 
-
 			float frontLegAngle = getLegWalkingAngle() * 5.0f;
 			float backLegAngle = -frontLegAngle;
 
@@ -140,8 +134,6 @@ namespace engine {
 			break; 
 		case Model::Pig:
 		{
-			const Mob* mobEntity = dynamic_cast<const Mob*>(&entity); 
-
 			float frontLegAngle = getLegWalkingAngle() * 5.0f;
 			float backLegAngle = -frontLegAngle;
 
@@ -153,7 +145,6 @@ namespace engine {
 			break; 
 		case Model::Cow:
 		{
-			const Mob* mobEntity = dynamic_cast<const Mob*>(&entity);
 
 			float frontLegAngle = getLegWalkingAngle() * 5.0f;
 			float backLegAngle = -frontLegAngle;
@@ -0,0 +1,353 @@
+#include "../../hdr/entity/Navigation.hpp"
+
+namespace engine {
+	namespace navigation {
+		// A node waiting to be expanded by the search. 
+		struct OpenNode {
+			int nodeIndex; 
+			float estimatedCost; 
+
+			bool operator>(const OpenNode& openNode) const {
+				return estimatedCost > openNode.estimatedCost; 
+			}
+		};
+		struct SharedPath {
+			gs::Vec2i start; 
+			gs::Vec2i goal; 
+			std::vector<Waypoint> waypoints; 
+			int tickFound; 
+			// Block edit stamps of the chunks the path crosses when found. 
+			unsigned int blockEditStamps; 
+		};
+
+		// Search state covers a window around the start of the search, and 
+		// is reused between searches. Nodes are only valid while their 
+		// stamp matches the current search. 
+		constexpr int searchWindowWidth = (maxSearchWidth * 2) + 1; 
+		constexpr int numOfSearchNodes = searchWindowWidth * Chunk::height; 
+
+		std::vector<float> nodeCosts(numOfSearchNodes); 
+		std::vector<int> nodeParents(numOfSearchNodes); 
+		std::vector<EdgeType> nodeEdgeTypes(numOfSearchNodes); 
+		std::vector<int> nodeStamps(numOfSearchNodes, 0); 
+		std::vector<OpenNode> openNodes; 
+		std::vector<SharedPath> sharedPaths; 
+		int searchStamp = 0; 
+		int searchesRemaining = maxSearchesPerTick; 
+		int currentTick = 0; 
+
+		bool isTileSolid(Block block) {
+			if (block.id <= Block::Air || block.tags.ignoreCollision)
+				return false; 
+
+			return collision::tileCollisions[block.id].collisionType 
+				== collision::CollisionType::Block; 
+		}
+		void buildColumn(const Chunk& chunk, int xpos) {
+			// Rows outside of the world are treated as open above the world,
+			// and as having no floor below it. 
+			bool abovePassable = true; 
+			Block block = chunk.getBlock(xpos, 0); 
+
+			for (int ypos = 0; ypos < Chunk::height; ypos++) {
+				const Block blockBelow = ypos + 1 < Chunk::height 
+					? chunk.getBlock(xpos, ypos + 1) : Block(); 
+				const bool passable = !isTileSolid(block) 
+					&& block.id != Block::Lava; 
+				const bool solidBelow = isTileSolid(blockBelow); 
+				std::uint8_t cell = 0; 
+
+				if (passable) {
+					cell |= Passable; 
+
+					if (abovePassable && solidBelow)
+						cell |= Standable; 
+				}
+
+				chunk.setNavigationCell(xpos, ypos, cell); 
+				abovePassable = passable; 
+				block = blockBelow; 
+			}
+
+			chunk.setNavigationColumnBuilt(xpos, true); 
+		}
+		int getNodeIndex(gs::Vec2i cell, int windowLeft) {
+			return ((cell.x - windowLeft) * Chunk::height) + cell.y; 
+		}
+		gs::Vec2i getNodeCell(int nodeIndex, int windowLeft) {
+			return gs::Vec2i(
+				windowLeft + (nodeIndex / Chunk::height), 
+				nodeIndex % Chunk::height
+			); 
+		}
+		// Moves the goal down onto the ground, for targets in the air. 
+		gs::Vec2i groundCell(gs::Vec2i cell) {
+			for (int dropHeight = 0; dropHeight <= maxDropHeight + 1; 
+				dropHeight++) 
+			{
+				const gs::Vec2i groundedCell = cell + gs::Vec2i(0, dropHeight); 
+
+				if (isCellStandable(groundedCell))
+					return groundedCell; 
+			}
+
+			return cell; 
+		}
+		// Combined edit stamps of the chunks between the path's ends. 
+		unsigned int getPathEditStamps(
+			gs::Vec2i start, gs::Vec2i goal, const std::vector<Waypoint>& path)
+		{
+			int startXpos = std::min(start.x, goal.x); 
+			int endXpos = std::max(start.x, goal.x); 
+
+			for (const auto& waypoint : path) {
+				startXpos = std::min(startXpos, waypoint.cell.x); 
+				endXpos = std::max(endXpos, waypoint.cell.x); 
+			}
+
+			return collision::getBlockEditStamps(startXpos, endXpos); 
+		}
+		bool findSharedPath(
+			gs::Vec2i start, gs::Vec2i goal, std::vector<Waypoint>& path) 
+		{
+			for (const auto& sharedPath : sharedPaths) {
+				if (sharedPath.goal != goal 
+					|| currentTick - sharedPath.tickFound > sharedPathLifetime)
+					continue; 
+				// Blocks along the path have been edited since it was found. 
+				if (getPathEditStamps(sharedPath.start, sharedPath.goal, 
+					sharedPath.waypoints) != sharedPath.blockEditStamps)
+					continue; 
+
+				if (sharedPath.start == start) {
+					path = sharedPath.waypoints; 
+					return true; 
+				}
+
+				// Mobs standing on the path can follow the rest of it. 
+				for (int waypointIndex = 0; waypointIndex < 
+					sharedPath.waypoints.size(); waypointIndex++) 
+				{
+					if (sharedPath.waypoints[waypointIndex].cell == start) {
+						path.assign(
+							sharedPath.waypoints.begin() + waypointIndex + 1,
+							sharedPath.waypoints.end()
+						); 
+						return true; 
+					}
+				}
+			}
+
+			return false; 
+		}
+		void addSharedPath(
+			gs::Vec2i start, gs::Vec2i goal, const std::vector<Waypoint>& path) 
+		{
+			const unsigned int blockEditStamps = 
+				getPathEditStamps(start, goal, path); 
+
+			if (sharedPaths.size() < maxSharedPaths) {
+				sharedPaths.push_back(
+					{ start, goal, path, currentTick, blockEditStamps }
+				); 
+				return; 
+			}
+
+			// Replaces the oldest path once the limit is reached. 
+			SharedPath& oldestPath = *std::min_element(
+				sharedPaths.begin(), sharedPaths.end(), 
+				[](const SharedPath& path1, const SharedPath& path2) {
+					return path1.tickFound < path2.tickFound; 
+				}
+			); 
+
+			oldestPath = { start, goal, path, currentTick, blockEditStamps }; 
+		}
+		void searchPath(
+			gs::Vec2i start, gs::Vec2i goal, std::vector<Waypoint>& path) 
+		{
+			const float walkCost = 1.0f; 
+			const float jumpCost = 1.5f; 
+			const float dropCost = 1.0f; 
+			const float dropCostPerTile = 0.25f; 
+			const int windowLeft = start.x - maxSearchWidth; 
+
+			// Every edge moves one column, so the horizontal distance never 
+			// overestimates the remaining cost. 
+			auto estimateCost = [&](gs::Vec2i cell) -> float {
+				return std::abs(goal.x - cell.x); 
+			}; 
+			auto getClosenessToGoal = [&](gs::Vec2i cell) -> int {
+				return std::abs(goal.x - cell.x) + std::abs(goal.y - cell.y); 
+			}; 
+
+			searchStamp++; 
+			openNodes.clear(); 
+
+			const int startIndex = getNodeIndex(start, windowLeft); 
+			int closestIndex = startIndex; 
+			int nodesExpanded = 0; 
+
+			nodeCosts[startIndex] = 0.0f; 
+			nodeParents[startIndex] = -1; 
+			nodeStamps[startIndex] = searchStamp; 
+			openNodes.push_back({ startIndex, estimateCost(start) }); 
+
+			auto visitNode = [&](int parentIndex, gs::Vec2i cell, 
+				EdgeType edgeType, float edgeCost) 
+			{
+				const int nodeIndex = getNodeIndex(cell, windowLeft); 
+				const float cost = nodeCosts[parentIndex] + edgeCost; 
+
+				if (nodeStamps[nodeIndex] == searchStamp 
+					&& nodeCosts[nodeIndex] <= cost)
+					return; 
+
+				nodeCosts[nodeIndex] = cost; 
+				nodeParents[nodeIndex] = parentIndex; 
+				nodeEdgeTypes[nodeIndex] = edgeType; 
+				nodeStamps[nodeIndex] = searchStamp; 
+				openNodes.push_back({ nodeIndex, cost + estimateCost(cell) }); 
+				std::push_heap(
+					openNodes.begin(), openNodes.end(), std::greater<>()
+				); 
+			}; 
+
+			while (!openNodes.empty() && nodesExpanded < maxNodesPerSearch) {
+				std::pop_heap(
+					openNodes.begin(), openNodes.end(), std::greater<>()
+				); 
+
+				const OpenNode openNode = openNodes.back(); 
+				const int nodeIndex = openNode.nodeIndex; 
+				const gs::Vec2i cell = getNodeCell(nodeIndex, windowLeft); 
+
+				openNodes.pop_back(); 
+
+				// Skips entries left behind after a cheaper route was found. 
+				if (openNode.estimatedCost > nodeCosts[nodeIndex] 
+						+ estimateCost(cell))
+					continue; 
+
+				nodesExpanded++; 
+
+				if (getClosenessToGoal(cell) 
+						< getClosenessToGoal(getNodeCell(closestIndex, windowLeft)))
+					closestIndex = nodeIndex; 
+				if (cell == goal)
+					break; 
+
+				for (int direction = -1; direction <= 1; direction += 2) {
+					const int nextXpos = cell.x + direction; 
+
+					if (std::abs(nextXpos - start.x) > maxSearchWidth)
+						continue; 
+
+					const gs::Vec2i walkCell = gs::Vec2i(nextXpos, cell.y); 
+					const gs::Vec2i jumpCell = walkCell 
+						- gs::Vec2i(0, maxJumpHeight); 
+
+					if (isCellStandable(walkCell))
+						visitNode(nodeIndex, walkCell, EdgeType::Walk, walkCost); 
+					else if (isCellStandable(jumpCell)) {
+						// Needs room above the mob to jump. 
+						if (getCell(cell - gs::Vec2i(0, maxJumpHeight + 1)) 
+								& Passable)
+							visitNode(nodeIndex, jumpCell, EdgeType::Jump, jumpCost); 
+					}
+					else if ((getCell(walkCell) & Passable) 
+						&& (getCell(jumpCell) & Passable)) 
+					{
+						// Falls down the next column onto the first floor. 
+						for (int dropHeight = 1; dropHeight <= maxDropHeight; 
+							dropHeight++) 
+						{
+							const gs::Vec2i dropCell = walkCell 
+								+ gs::Vec2i(0, dropHeight); 
+							const std::uint8_t dropCellFlags = getCell(dropCell); 
+
+							if (!(dropCellFlags & Passable))
+								break; 
+							if (dropCellFlags & Standable) {
+								visitNode(nodeIndex, dropCell, EdgeType::Drop, 
+									dropCost + (dropHeight * dropCostPerTile)); 
+								break; 
+							}
+						}
+					}
+				}
+			}
+
+			path.clear(); 
+
+			for (int nodeIndex = closestIndex; nodeIndex != startIndex; 
+				nodeIndex = nodeParents[nodeIndex]) 
+			{
+				path.push_back({ 
+					getNodeCell(nodeIndex, windowLeft), nodeEdgeTypes[nodeIndex] 
+				}); 
+			}
+
+			std::reverse(path.begin(), path.end()); 
+		}
+
+		std::uint8_t getCell(gs::Vec2i cell) {
+			if (cell.y < 0 || cell.y >= Chunk::height)
+				return 0; 
+
+			const int chunkOffset = World::getChunkOffset(cell.x); 
+			const Chunk* chunk = world->getChunk(chunkOffset); 
+
+			if (chunk == nullptr)
+				return 0; 
+
+			const int chunkXpos = cell.x - (chunkOffset * Chunk::width); 
+
+			if (!chunk->isNavigationColumnBuilt(chunkXpos))
+				buildColumn(*chunk, chunkXpos); 
+
+			return chunk->getNavigationCell(chunkXpos, cell.y); 
+		}
+		bool isCellStandable(gs::Vec2i cell) {
+			return getCell(cell) & Standable; 
+		}
+		gs::Vec2i getFeetCell(const Entity& entity) {
+			// Offset slightly so entities resting on the floor aren't placed 
+			// inside of it. 
+			const float bottomOffset = 0.01f; 
+
+			return gs::Vec2i(
+				std::floor(entity.position.x), 
+				std::floor(entity.position.y + (entity.size.y / 2.0f) 
+					- bottomOffset)
+			); 
+		}
+
+		void beginTick() {
+			currentTick++; 
+			searchesRemaining = maxSearchesPerTick; 
+		}
+		bool findPath(
+			gs::Vec2i start, gs::Vec2i goal, std::vector<Waypoint>& path) 
+		{
+			if (!isCellStandable(start))
+				return false; 
+
+			goal = groundCell(goal); 
+
+			if (findSharedPath(start, goal, path))
+				return true; 
+			if (searchesRemaining == 0)
+				return false; 
+
+			searchesRemaining--; 
+			searchPath(start, goal, path); 
+			addSharedPath(start, goal, path); 
+
+			return true; 
+		}
+		void clearSharedPaths() {
+			sharedPaths.clear(); 
+		}
+	}
+}
\ No newline at end of file
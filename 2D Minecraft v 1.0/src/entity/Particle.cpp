@@ -11,9 +11,7 @@ namespace engine {
 		collisionEnabled(false), 
 		rotation(0.0f),
 		rotationalSpeed(0.0f),
-		timeRemaining(-1), 
-		active(false),
-		reserved(false)
+		timeRemaining(-1)
 	{
 	}
 	Particle::Particle(Type type) : Particle() {
@@ -44,67 +42,31 @@ namespace engine {
 			color = gs::Color(
 				220, 230, 255, 100.0f + (generateNormalizedFloat() * 100.0f)
 			); 
-			reserved = true; 
 		}
 			break; 
-		case Type::DamagePoint:
-			timeRemaining = 60; 
-			color = gs::Color::Yellow; 
-			break;
 		}
 
 		mass = 1.0f; 
 		collisionEnabled = false; 
-		// If type is passed into the constructor, it is assumed to be needed.
-		active = true; 
 	}
 	
 	void Particle::applyAcceleration(gs::Vec2f acceleration) {
 		velocity += acceleration; 
 	}
 	void Particle::update() {
-		switch (type) {
-		case Type::Generic:
-			applyGravity(*this); 
-			
-			gs::util::approach(
-				&velocity.x, 0.0f, collisionEnabled ? 5.0f : 20.0f
-			); 
-
-			color.a = std::min(
-				timeRemaining * (collisionEnabled ? 5 : 15), 255
-			); 
-			break;
-		case Type::Star:
-		{
-			const float verticalSafetyOffset = 10.0f; 
-
-			position.x = gs::util::mod(
-				position.x,
-				static_cast<float>(render::window::defaultWindowWidth)
-			);
-			position.y += verticalSafetyOffset;
-			position.y = gs::util::mod(position.y, starLowerHorizon);
-			position.y -= verticalSafetyOffset;
-		}
-			break;
-		case Type::DamagePoint:
-			break; 
-		}
+		const float verticalSafetyOffset = 10.0f; 
 
-		if (collisionEnabled)
-			collision::applyCollision(*this, *world);
+		position.x = gs::util::mod(
+			position.x,
+			static_cast<float>(render::window::defaultWindowWidth)
+		);
+		position.y += verticalSafetyOffset;
+		position.y = gs::util::mod(position.y, starLowerHorizon);
+		position.y -= verticalSafetyOffset;
 
 		updatePosition();
-		timeRemaining = std::max(timeRemaining - 1, -1); 
-		// Stops using particle if the time remaining equals zero. 
-		active = timeRemaining != 0; 
 	}
 
-	const bool Particle::litParticles[static_cast<int>(Type::End)] = {
-		true, false, false 
-	};
-	const int Particle::numOfStars = 200;
 	const float Particle::starLowerHorizon = 600.0f;
 	
 	void Particle::generateBlockParticles(
@@ -163,33 +125,147 @@ namespace engine {
 		}
 	}
 
-	Particle particles[Particle::numOfParticles];
+	void ParticleStore::add(const Particle& particle) {
+		// New particles are dropped once the store is full. 
+		if (numOfParticles == Particle::numOfParticles)
+			return; 
+
+		const int particleIndex = numOfParticles++; 
+
+		positionsX[particleIndex] = particle.position.x; 
+		positionsY[particleIndex] = particle.position.y; 
+		velocitiesX[particleIndex] = particle.velocity.x; 
+		velocitiesY[particleIndex] = particle.velocity.y; 
+		rotations[particleIndex] = particle.rotation; 
+		rotationalSpeeds[particleIndex] = particle.rotationalSpeed; 
+		maxFallVelocities[particleIndex] = terminalVelocity * particle.mass; 
+		// Same as approaching zero by 5% or 20% each tick. 
+		dragScalers[particleIndex] = particle.collisionEnabled ? 0.95f : 0.8f; 
+		fadeRates[particleIndex] = particle.collisionEnabled ? 5 : 15; 
+		timesRemaining[particleIndex] = particle.timeRemaining; 
+		collisionEnabled[particleIndex] = particle.collisionEnabled; 
+		sizes[particleIndex] = particle.size; 
+		colors[particleIndex] = particle.color; 
+
+		if (particle.collisionEnabled)
+			numOfColliding++; 
+	}
+	void ParticleStore::remove(int particleIndex) {
+		const int lastIndex = --numOfParticles; 
+
+		if (collisionEnabled[particleIndex])
+			numOfColliding--; 
+
+		// Fills the gap with the last particle to keep the arrays packed. 
+		positionsX[particleIndex] = positionsX[lastIndex]; 
+		positionsY[particleIndex] = positionsY[lastIndex]; 
+		velocitiesX[particleIndex] = velocitiesX[lastIndex]; 
+		velocitiesY[particleIndex] = velocitiesY[lastIndex]; 
+		rotations[particleIndex] = rotations[lastIndex]; 
+		rotationalSpeeds[particleIndex] = rotationalSpeeds[lastIndex]; 
+		maxFallVelocities[particleIndex] = maxFallVelocities[lastIndex]; 
+		dragScalers[particleIndex] = dragScalers[lastIndex]; 
+		fadeRates[particleIndex] = fadeRates[lastIndex]; 
+		timesRemaining[particleIndex] = timesRemaining[lastIndex]; 
+		collisionEnabled[particleIndex] = collisionEnabled[lastIndex]; 
+		sizes[particleIndex] = sizes[lastIndex]; 
+		colors[particleIndex] = colors[lastIndex]; 
+	}
+	void ParticleStore::update() {
+		// Gravity, drag and movement are applied in separate loops without 
+		// branches, so the compiler is able to vectorize them. 
+		for (int particleIndex = 0; particleIndex < numOfParticles; 
+			particleIndex++) 
+		{
+			velocitiesY[particleIndex] = std::min(
+				velocitiesY[particleIndex] + gravitationalStrength, 
+				maxFallVelocities[particleIndex]
+			); 
+			velocitiesX[particleIndex] *= dragScalers[particleIndex]; 
+		}
+		for (int particleIndex = 0; particleIndex < numOfParticles; 
+			particleIndex++) 
+		{
+			colors[particleIndex].a = std::min(
+				timesRemaining[particleIndex] * fadeRates[particleIndex], 255
+			); 
+		}
+
+		if (numOfColliding > 0) {
+			for (int particleIndex = 0; particleIndex < numOfParticles; 
+				particleIndex++) 
+			{
+				if (!collisionEnabled[particleIndex])
+					continue; 
+
+				collision::Hitbox hitbox = {
+					gs::Vec2f(positionsX[particleIndex], 
+						positionsY[particleIndex]), 
+					gs::Vec2f(velocitiesX[particleIndex], 
+						velocitiesY[particleIndex]), 
+					sizes[particleIndex], gs::Vec2f(1.0f, 1.0f), 1, 
+					collision::Collisions()
+				}; 
+
+				collision::applyCollision(hitbox, *world); 
+
+				positionsX[particleIndex] = hitbox.position.x; 
+				positionsY[particleIndex] = hitbox.position.y; 
+				velocitiesX[particleIndex] = hitbox.velocity.x; 
+				velocitiesY[particleIndex] = hitbox.velocity.y; 
+			}
+		}
+
+		for (int particleIndex = 0; particleIndex < numOfParticles; 
+			particleIndex++) 
+		{
+			positionsX[particleIndex] += velocitiesX[particleIndex]; 
+			positionsY[particleIndex] += velocitiesY[particleIndex]; 
+			rotations[particleIndex] += rotationalSpeeds[particleIndex]; 
+			timesRemaining[particleIndex] = std::max(
+				timesRemaining[particleIndex] - 1, -1
+			); 
+		}
+
+		// Walks backwards so the particles moved into removed slots have 
+		// already been checked. 
+		for (int particleIndex = numOfParticles - 1; particleIndex >= 0; 
+			particleIndex--) 
+		{
+			if (timesRemaining[particleIndex] == 0)
+				remove(particleIndex); 
+		}
+	}
+
+	ParticleStore particleStore; 
+	Particle stars[Particle::numOfStars]; 
+	std::vector<DamageText> damageTexts; 
 	int particlesRendered = 0; 
 	
 	void initStars() {
-		for (int starIndex = 0; starIndex < Particle::numOfStars; starIndex++) 
-			addParticle(Particle(Particle::Type::Star)); 
+		for (auto& star : stars) 
+			star = Particle(Particle::Type::Star); 
 	}
 	void addParticle(const Particle& particle) {
-		for (auto& oldParticle : particles) {
-			if (!oldParticle.reserved && !oldParticle.active) {
-				oldParticle = particle; 
-				oldParticle.active = true; 
-				break; 
-			}
-		}
+		particleStore.add(particle); 
+	}
+	void addDamageText(const std::string& string, gs::Vec2f position) {
+		damageTexts.push_back({ string, position, gs::Color::Yellow, 60 }); 
 	}
 	void updateParticles() {
 		if (world == nullptr)
 			return; 
 
-		for (int particleIndex = 0; particleIndex < Particle::numOfParticles;
-			particleIndex++)
-		{
-			Particle& particle = particles[particleIndex]; 
+		for (auto& star : stars)
+			star.update(); 
 
-			if (particle.active)
-				particle.update(); 
-		}
+		particleStore.update(); 
+
+		for (auto& damageText : damageTexts)
+			damageText.timeRemaining--; 
+
+		std::erase_if(damageTexts, [](const DamageText& damageText) {
+			return damageText.timeRemaining <= 0; 
+		}); 
 	}
 }
\ No newline at end of file
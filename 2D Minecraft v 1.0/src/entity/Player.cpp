@@ -157,7 +157,7 @@ namespace engine {
 
 			gs::util::approach(&velocity.x, 0.0f, 20.0f);
 
-			collision::applyCollision(*this, *world, velocity.x < 0.0f);
+			collision::applyCollision(*this, *world);
 			updatePosition();
 
 			if (collisions.floor) {
@@ -466,8 +466,8 @@ namespace engine {
 						switch (toolType) {
 						case ItemInfo::ToolType::Hoe:
 						{
-							Block& blockSelected = 
-								world->getBlockRef(mouseTilePosition); 
+							const Block blockSelected = 
+								world->getBlock(mouseTilePosition); 
 
 							if (blockSelected.id == Block::Dirt
 								|| blockSelected.id == Block::GrassBlock)
@@ -625,9 +625,16 @@ namespace engine {
 		}
 	}
 
+	bool Player::isBurning() const {
+		return burningTicks > 0; 
+	}
+
 	ItemContainer& Player::getItemContainerSelected() {
 		return inventory[render::ui::hotbarIndex]; 
 	}
+	const ItemContainer& Player::getItemContainerSelected() const {
+		return inventory[render::ui::hotbarIndex]; 
+	}
 	std::string Player::getSaveString() const {
 		std::string saveString = Entity::getSaveString(); 
 
@@ -692,9 +699,6 @@ namespace engine {
 	int foodEatingCooldown = Player::foodEatingCooldownDuration;
 
 	void createPlayer() {
-		Entity::numOfEntities = 0; 
 		player = new engine::Player();
-
-		addEntity(Entity::Type::PlayerEntity, player);
 	}
 }
\ No newline at end of file
@@ -44,7 +44,7 @@ namespace engine {
 
 			velocity += speedVector; 
 			velocity.y += gravitationalStrength * mass; 
-			collision::applyCollision(*this, *world, velocity.x < 0.0f);
+			collision::applyCollision(*this, *world);
 			updatePosition();
 
 			if (velocity.x != 0.0f)
@@ -62,6 +62,9 @@ namespace engine {
 		}
 
 		dead = timeLeft <= 0;
-		timeLeft--;
+		timeLeft -= updateTicks;
 	}
+
+	EntityPool<ProjectileEntity> projectileEntities; 
+	EntityGrid<ProjectileEntity> projectileEntityGrid(projectileEntities); 
 }
\ No newline at end of file
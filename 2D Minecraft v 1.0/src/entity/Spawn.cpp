@@ -69,7 +69,8 @@ namespace engine {
 				< position.x + blockCheckingRange.x; xpos++)
 			{
 				const Block block = world->getBlock(xpos, ypos);
-				const TileColor tileColor = world->getTileColor(xpos, ypos);
+				const TileColor lightColor = 
+					render::lighting::getSpawningLightColor(xpos, ypos);
 				const collision::CollisionType collisionType =
 					static_cast<collision::CollisionType>(block.getVar(
 						BlockInfo::collisionType));
@@ -77,7 +78,7 @@ namespace engine {
 				if (groundBlock) {
 					if (collisionType == collision::CollisionType::Block) {
 						if (mobBehavior == Mob::Behavior::Hostile) {
-							if (render::lighting::colorGreaterThan(tileColor,
+							if (render::lighting::colorGreaterThan(lightColor,
 									render::lighting::moonlightColor))
 								return false; 
 						}
@@ -159,42 +160,28 @@ namespace engine {
 				if (isValidSpawningPosition(
 					spawningPosition, mobSize, mobBehavior)) 
 				{
-					float lowestMobDistance = 1000.0f; 
-
-					// Finds closest mob. 
-					for (auto& [entityType, entity] : entities) {
-						if (entityType == Entity::Type::Mob) {
-							const Mob* mobEntity = dynamic_cast<Mob*>(entity);
-
-							// Makes sure behavior matches mob being spawned. 
-							if (mobEntity->behavior == mobBehavior) {
-								lowestMobDistance = std::min(gs::util::distance(
-									mobEntity->position, 
-									gs::Vec2f(spawningPosition)
-								), lowestMobDistance); 
-
-								// Stops searching for closer mob once the min
-								// spawn distance is reached. 
-								if (lowestMobDistance < minMobDistance)
-									break; 
-							}
+					// Finds closest mob, whose behavior matches the mob being
+					// spawned. 
+					const Mob* closestMob = mobGrid.findNearest(
+						gs::Vec2f(spawningPosition), minMobDistance, 
+						[&](const Mob& mobEntity) {
+							return mobEntity.behavior == mobBehavior; 
 						}
-					}
+					); 
 
 					// Only spawns mob if it wouldn't be too close to other 
 					// mobs.
-					if (lowestMobDistance >= minMobDistance) {
-						Mob* newMob = new Mob;
+					if (closestMob == nullptr) {
+						Mob newMob(mobType);
 
 						// Sets mob position to be standing on the center of 
 						// the selected block. 
-						newMob->position.x = spawningPosition.x
+						newMob.position.x = spawningPosition.x
 							+ (mobSize.x / 2.0f);
-						newMob->position.y = spawningPosition.y
+						newMob.position.y = spawningPosition.y
 							- (mobSize.y / 2.0f);
-						newMob->type = mobType;
 
-						addEntity(Entity::Type::Mob, newMob);
+						mobGrid.add(newMob); 
 					}
 				}
 			}
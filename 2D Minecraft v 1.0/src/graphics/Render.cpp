@@ -30,7 +30,8 @@ namespace engine {
 			// Zooming camera in and out. 
 			const float zoomStep = 0.25f; 
 			const float zoomDivisor = 1.0f / zoomStep; 
-			const float zoomSpeed = (std::log2(cameraScale) / 2.0f) + zoomStep;
+			const float zoomSpeed = std::max(
+				(std::log2(cameraScale) / 2.0f) + zoomStep, zoomStep);
 			const float originalCameraScale = cameraScale; 
 
 			if (!ui::gameOver) {
@@ -42,9 +43,6 @@ namespace engine {
 
 			gs::util::clamp(&cameraScale, minCameraScale, maxCameraScale); 
 
-			if (cameraScale < originalCameraScale) 
-				lighting::forceLights = true;
-
 			// Constrain camera to vertical bounds. 
 			const float verticalCameraOffset = window::screenCenter.y
 				/ (tileSize * cameraScale);
@@ -97,6 +95,18 @@ namespace engine {
 			gs::util::clamp(&renderableVerticalLightRange.x, 0, Chunk::height); 
 			gs::util::clamp(&renderableVerticalLightRange.y, 0, Chunk::height); 
 
+			// Zooming out reveals tiles which haven't been lit yet. 
+			if (cameraScale < originalCameraScale) {
+				lighting::markLightingDirty(sf::IntRect(
+					renderableHorizontalLightRange.x, 
+					renderableVerticalLightRange.x, 
+					renderableHorizontalLightRange.y 
+						- renderableHorizontalLightRange.x, 
+					renderableVerticalLightRange.y 
+						- renderableVerticalLightRange.x
+				)); 
+			}
+
 			// Updating which spawning tiles horizontally need to be relit. 
 			renderableHorizontalSpawningLightRange.x = -Chunk::width 
 				+ normalizedCameraPosition.x - maxSpawningDistance.x
@@ -114,10 +124,10 @@ namespace engine {
 					+ lighting::Light::maxLightRadius;
 
 			gs::util::clamp(
-				&renderableVerticalSpawningLightRange.x, 0, Chunk::width
+				&renderableVerticalSpawningLightRange.x, 0, Chunk::height
 			); 
 			gs::util::clamp(
-				&renderableVerticalSpawningLightRange.y, 0, Chunk::width
+				&renderableVerticalSpawningLightRange.y, 0, Chunk::height
 			);
 		}
 		float scaleValue(float value) {
@@ -165,6 +175,10 @@ namespace engine {
 
 		gs::Transition transition;
 		sf::VertexArray skyBox(sf::Quads, 4); 
+		sf::RenderTexture backgroundRenderTexture; 
+		sf::Sprite backgroundRenderTextureSprite; 
+		BackgroundCacheKey backgroundCacheKey; 
+		bool backgroundCached = false; 
 		sf::RenderTexture worldRenderTexture;
 		sf::Sprite worldRenderTextureSprite;
 		bool shouldSunAndMoonBeRendered = true;
@@ -183,19 +197,37 @@ namespace engine {
 		sf::Image blockAtlasImage, wallAtlasImage;
 		sf::Texture blockOverlayAtlas;
 		sf::Sprite blockSprite, wallSprite; 
-		sf::Vertex tileVerticies[maxNumOfTiles * 4];
-		sf::Vertex tileOverlayVerticies[maxNumOfTiles * 4];
-		int tileVertexIndex = 0, tileOverlayVertexIndex = 0; 
+		VertexArena tileVertexArena, tileOverlayVertexArena; 
+		std::vector<const Chunk*> visibleChunks; 
+		std::vector<ChunkMesh*> visibleChunkMeshes; 
+		std::vector<gs::Vec2i> chunkVertexOffsets; 
+		std::vector<int> chunkLightVertexCounts; 
 		sf::RenderTexture lightMap;
 		sf::Sprite lightMapSprite;
-		sf::Vertex lightMapVerticies[maxNumOfTiles * 4];
-		int lightVertexIndex = 0; 
+		VertexArena lightMapVertexArena; 
+		sf::Texture lightMapTexture; 
+		sf::Sprite lightMapTextureSprite; 
+		std::vector<sf::Uint8> lightMapPixels; 
+		gs::Vec2i lightMapPixelsSize; 
 		sf::Texture tileBreakingStageTextures[10];
 		sf::Sprite tileBreakingStageSprite;
 		int tilesRendered = 0;
+		int tilesRebuilt = 0; 
+		std::unordered_map<int, ChunkMesh> chunkMeshes; 
+		sf::Sprite impostorSprite; 
+		gs::Color blockImpostorColors[Block::End]; 
+		gs::Color wallImpostorColors[Wall::End]; 
 		sf::Texture entitySegmentTextures[Model::End]
 			[Model::Segment::maxNumOfSegments];
-		sf::Sprite entitySegmentSprite;
+		sf::Texture entityAtlas; 
+		sf::IntRect entitySegmentTextureBounds[Model::End]
+			[Model::Segment::maxNumOfSegments];
+		gs::Vec2i itemAtlasOffsets[numOfItemAtlases]; 
+		VertexArena entityVertexArena; 
+		VertexArena particleVertexArena, damageTextVertexArena; 
+		sf::Glyph damageTextGlyphs[numOfDamageTextGlyphs]; 
+		bool damageTextGlyphsCached = false; 
+		int drawCalls = 0; 
 
 		void loadAssets() {
 			// Load sun & moon textures. 
@@ -284,6 +316,12 @@ namespace engine {
 			); 
 			skyBox[3].position = gs::Vec2f(0.0f, window::defaultWindowHeight); 
 
+			// Initialize backgroundRenderTexture. 
+			backgroundRenderTexture.create(
+				window::defaultWindowWidth, window::defaultWindowHeight); 
+			backgroundRenderTextureSprite.setTexture(
+				backgroundRenderTexture.getTexture()); 
+
 			// Initialize worldRenderTexture. 
 			worldRenderTexture.create(window::defaultWindowWidth, window::defaultWindowHeight); 
 			worldRenderTextureSprite.setTexture(worldRenderTexture.getTexture()); 
@@ -305,6 +343,9 @@ namespace engine {
 			// Initialize lightMap. 
 			lightMap.create(window::defaultWindowWidth, window::defaultWindowHeight); 
 			lightMapSprite.setTexture(lightMap.getTexture());
+
+			createEntityAtlas(); 
+			createImpostorColors(); 
 		}
 		float getBaseSkyBrightness(GameTime::GameTick gameTicks) {
 			const float c0 = 320.0f, c1 = 230.0f;
@@ -395,6 +436,13 @@ namespace engine {
 				); 
 			}
 		}
+		void applyTextureBounds(sf::Vertex* quads, sf::IntRect bounds) {
+			quads[0].texCoords = gs::Vec2f(bounds.left, bounds.top); 
+			quads[1].texCoords = gs::Vec2f(bounds.left + bounds.width, bounds.top); 
+			quads[2].texCoords = gs::Vec2f(
+				bounds.left + bounds.width, bounds.top + bounds.height); 
+			quads[3].texCoords = gs::Vec2f(bounds.left, bounds.top + bounds.height); 
+		}
 		void applyVertexBounds(
 			sf::Vertex* quads, gs::Vec2f position, gs::Vec2f size)
 		{
@@ -403,6 +451,27 @@ namespace engine {
 			quads[2].position = position + size; 
 			quads[3].position = position + gs::Vec2f(0.0f, size.y);
 		}
+		void applyVertexBounds(
+			sf::Vertex* quads, gs::Vec2f center, gs::Vec2f size, float rotation) 
+		{
+			const float radians = gs::util::toRadians(rotation); 
+			const float cosine = std::cos(radians); 
+			const float sine = std::sin(radians); 
+			const gs::Vec2f halfSize = size * 0.5f; 
+			const gs::Vec2f corners[4] = {
+				gs::Vec2f(-halfSize.x, -halfSize.y), 
+				gs::Vec2f(halfSize.x, -halfSize.y), 
+				halfSize, 
+				gs::Vec2f(-halfSize.x, halfSize.y)
+			};
+
+			for (int quad = 0; quad < 4; quad++) {
+				quads[quad].position = center + gs::Vec2f(
+					(corners[quad].x * cosine) - (corners[quad].y * sine), 
+					(corners[quad].x * sine) + (corners[quad].y * cosine)
+				); 
+			}
+		}
 		void resizeSpriteBounds(sf::Sprite& sprite) {
 			const gs::Vec2u textureSize = sprite.getTexture()->getSize();
 
@@ -411,6 +480,98 @@ namespace engine {
 			));
 		}
 
+		void createEntityAtlas() {
+			const int atlasWidth = 1024; 
+			// Keeps neighbouring textures from bleeding into each other. 
+			const int padding = 1; 
+
+			struct AtlasEntry {
+				sf::Image image; 
+				sf::IntRect* bounds; 
+			};
+
+			std::vector<AtlasEntry> atlasEntries; 
+			sf::IntRect itemAtlasBounds[numOfItemAtlases]; 
+			const sf::Texture* itemAtlases[numOfItemAtlases] = {
+				&ui::itemAtlas, &blockAtlas, &wallAtlas
+			};
+
+			for (int atlasIndex = 0; atlasIndex < numOfItemAtlases; atlasIndex++) {
+				atlasEntries.push_back({ 
+					itemAtlases[atlasIndex]->copyToImage(), 
+					&itemAtlasBounds[atlasIndex] 
+				}); 
+			}
+			for (int modelIndex = 1; modelIndex < Model::End; modelIndex++) {
+				for (int segmentIndex = 0; segmentIndex <
+					Model::Segment::maxNumOfSegments; segmentIndex++)
+				{
+					const sf::Texture& segmentTexture = 
+						entitySegmentTextures[modelIndex][segmentIndex]; 
+
+					// Not every model uses every segment. 
+					if (segmentTexture.getSize().x == 0)
+						continue; 
+
+					atlasEntries.push_back({ 
+						segmentTexture.copyToImage(), 
+						&entitySegmentTextureBounds[modelIndex][segmentIndex]
+					}); 
+				}
+			}
+
+			// Packs the textures into rows, left to right. 
+			gs::Vec2i position; 
+			int rowHeight = 0; 
+
+			for (AtlasEntry& atlasEntry : atlasEntries) {
+				const gs::Vec2i size = gs::Vec2i(atlasEntry.image.getSize()); 
+
+				if (position.x + size.x > atlasWidth) {
+					position = gs::Vec2i(0, position.y + rowHeight + padding); 
+					rowHeight = 0; 
+				}
+
+				*atlasEntry.bounds = sf::IntRect(position, size); 
+
+				position.x += size.x + padding; 
+				rowHeight = std::max(rowHeight, size.y); 
+			}
+
+			sf::Image atlasImage; 
+
+			atlasImage.create(atlasWidth, position.y + rowHeight, 
+				gs::Color::Transparent); 
+
+			for (const AtlasEntry& atlasEntry : atlasEntries) {
+				atlasImage.copy(atlasEntry.image, atlasEntry.bounds->left, 
+					atlasEntry.bounds->top); 
+			}
+
+			entityAtlas.loadFromImage(atlasImage); 
+
+			for (int atlasIndex = 0; atlasIndex < numOfItemAtlases; atlasIndex++) {
+				itemAtlasOffsets[atlasIndex] = gs::Vec2i(
+					itemAtlasBounds[atlasIndex].left, 
+					itemAtlasBounds[atlasIndex].top
+				); 
+			}
+		}
+		sf::IntRect getItemTextureBounds(const Item& item) {
+			const int textureIndex = item.getVar(ItemInfo::textureIndex);
+			const int atlasIndex = std::min(
+				textureIndex / ItemInfo::defaultTileItems, numOfItemAtlases - 1
+			);
+
+			sf::IntRect bounds = generateTextureBounds(
+				textureIndex - (atlasIndex * ItemInfo::defaultTileItems)); 
+
+			bounds.left += itemAtlasOffsets[atlasIndex].x; 
+			bounds.top += itemAtlasOffsets[atlasIndex].y; 
+
+			return bounds; 
+		}
+
 		void updateBackground() {
 			if (!renderBiomeBackground)
 				return; 
@@ -450,7 +611,7 @@ namespace engine {
 			prvsBiome = currentBiome; 
 		}
 
-		void renderSky(GameTime gameTime) {
+		void updateSkyColors(GameTime gameTime) {
 			auto skyBrightnessParabola = [](GameTime::GameTick gameTicks) 
 				-> float
 			{
@@ -508,10 +669,13 @@ namespace engine {
 
 			skyBox[0].color = skyBox[1].color = currentTopSkyColor; 
 			skyBox[2].color = skyBox[3].color = currentBottomSkyColor; 
+		}
+		void renderSky(GameTime gameTime, sf::RenderTarget& target) {
+			updateSkyColors(gameTime); 
 
-			window::winmain->draw(skyBox);
+			target.draw(skyBox);
 		}
-		void renderStars(GameTime gameTime) {
+		void renderStars(GameTime gameTime, sf::RenderTarget& target) {
 			if (!shouldStarsBeRendered)
 				return; 
 
@@ -524,12 +688,12 @@ namespace engine {
 			if (starBrightness == 0.0f)
 				return; 
 
-			for (auto& particle : particles) {
-				if (particle.type == Particle::Type::Star) 
-					renderParticle(particle); 
-			}
+			for (const auto& star : stars) 
+				renderStar(star); 
+
+			flushParticleQuads(target); 
 		}
-		void renderSunAndMoon(GameTime gameTime) {
+		void renderSunAndMoon(GameTime gameTime, sf::RenderTarget& target) {
 			auto getSunAndMoonAngle = [](GameTime gameTime, bool isSun)
 				-> float
 			{
@@ -591,7 +755,7 @@ namespace engine {
 				255, 255, 255, getSunAndMoonAlpha(gameTime, true)
 			));
 
-			window::winmain->draw(sunSprite); 
+			target.draw(sunSprite); 
 
 			moonSprite.setScale(sunSprite.getScale()); 
 			moonSprite.setPosition(getSunAndMoonPosition(gameTime, false));
@@ -599,9 +763,13 @@ namespace engine {
 				255, 255, 255, getSunAndMoonAlpha(gameTime, false)
 			));
 
-			window::winmain->draw(moonSprite);
+			target.draw(moonSprite);
+		}
+		float getBiomeBackgroundScale() {
+			// Zooming out past a scale of 1 keeps the backgrounds full size. 
+			return std::max(1.0f + std::log2(cameraScale), 1.0f);
 		}
-		void renderBiomeBackground() {
+		void renderBiomeBackground(sf::RenderTarget& target) {
 			const decltype(biomeBackgrounds.first)* sortedBiomeBackgrounds[2] = {
 				&biomeBackgrounds.second, &biomeBackgrounds.first
 			}; 
@@ -618,7 +786,7 @@ namespace engine {
 				biomeBackgroundSprite.setTexture(selectedTexture); 
 				resizeSpriteBounds(biomeBackgroundSprite); 
 
-				const float biomeBackgroundScale = 1.0f + std::log2(cameraScale);
+				const float biomeBackgroundScale = getBiomeBackgroundScale();
 				const float biomeBackgroundWidth = selectedTexture.getSize().x;
 				const float horizontalOffset = gs::util::mod(
 					-player->position.x * 5.0f * biomeBackgroundScale,
@@ -657,31 +825,73 @@ namespace engine {
 
 					biomeBackgroundSprite.setColor(biomeBackgroundColor);
 
-					window::winmain->draw(biomeBackgroundSprite);
+					target.draw(biomeBackgroundSprite);
 				}
 			}
 		}
+		BackgroundCacheKey getBackgroundCacheKey() {
+			return {
+				world->gameTime.gameTicks / backgroundTicksPerBucket, 
+				cameraScale, 
+				{ shouldStarsBeRendered, shouldSunAndMoonBeRendered }
+			};
+		}
 		void renderBackground() {
-			renderSky(world->gameTime); 
-			renderStars(world->gameTime); 
+			// The background is the first thing rendered each frame. 
+			drawCalls = 0; 
+
+			// Lighting relies on the sky colors, so they are always updated. 
+			updateSkyColors(world->gameTime); 
+
+			const BackgroundCacheKey currentBackgroundCacheKey = 
+				getBackgroundCacheKey(); 
+
+			if (!backgroundCached 
+				|| currentBackgroundCacheKey != backgroundCacheKey) 
+			{
+				backgroundRenderTexture.draw(skyBox); 
+				renderStars(world->gameTime, backgroundRenderTexture); 
+
+				if (shouldSunAndMoonBeRendered)
+					renderSunAndMoon(world->gameTime, backgroundRenderTexture); 
+
+				backgroundRenderTexture.display(); 
+				backgroundCacheKey = currentBackgroundCacheKey; 
+				backgroundCached = true; 
+			}
+
+			window::winmain->draw(backgroundRenderTextureSprite); 
+			drawCalls++; 
 
-			if (shouldSunAndMoonBeRendered)
-				renderSunAndMoon(world->gameTime); 
 			if (shouldBiomeBackgroundBeRendered)
 				renderBiomeBackground(); 
 		}
-		void renderChunkLayer(const Chunk& chunk, int layerIndex) {
+		ChunkMesh::ChunkMesh() : 
+			chunk(nullptr)
+		{
+		}
+
+		int buildChunkMeshSection(
+			const Chunk& chunk, ChunkMesh& chunkMesh, int sectionIndex) 
+		{
 			auto calculateHorizontalOffset = [](gs::Vec2i position) -> int {
 				return -4 + (std::abs(position.x * 123) % 9); 
 			}; 
 
-			const bool isBlockLayer = layerIndex > 0;
 			const gs::Color biomeColors[3] = {
 				BiomeInfo::biomeInfo[getBiome(chunk.offset - 1)].color,
 				BiomeInfo::biomeInfo[getBiome(chunk.offset)].color,
 				BiomeInfo::biomeInfo[getBiome(chunk.offset + 1)].color
 			};
+			// Offsets are stored in tiles, rather than pixels. 
+			const float pixelSize = 1.0f / tileSize; 
 
+			for (int layerIndex = 0; layerIndex < numOfWorldLayers; layerIndex++) {
+				chunkMesh.tileVerticies[layerIndex][sectionIndex].clear(); 
+				chunkMesh.tileOverlayVerticies[layerIndex][sectionIndex].clear(); 
+			}
+
+			int tilesBuilt = 0; 
 			gs::Vec2i tilePosition;
 
 			for (tilePosition.x = 0; tilePosition.x < Chunk::width; 
@@ -701,111 +911,297 @@ namespace engine {
 					std::fmod(biomeColorPercentage, 100.0f)
 				);
 
-				for (tilePosition.y = renderableVerticalRange.x; 
-					tilePosition.y < renderableVerticalRange.y; 
+				// Adds the quads of a tile to the mesh of a layer. 
+				auto addTile = [&](int layerIndex, int textureIndex, int rotation,
+					gs::Vec2f position, gs::Vec2f size, bool renderBlockOverlay,
+					bool renderUnderside) 
+				{
+					// Makes sure the tiles texture exists. 
+					if (textureIndex == 0)
+						return; 
+
+					if (!renderBlockOverlay || renderUnderside) {
+						std::vector<sf::Vertex>& verticies = 
+							chunkMesh.tileVerticies[layerIndex][sectionIndex]; 
+
+						verticies.resize(verticies.size() + 4); 
+						applyVertexBounds(&verticies[verticies.size() - 4], 
+							position, size);
+						applyTextureBounds(textureIndex, 
+							&verticies[verticies.size() - 4], rotation); 
+					}
+					if (renderBlockOverlay) [[unlikely]] {
+						std::vector<sf::Vertex>& verticies = 
+							chunkMesh.tileOverlayVerticies[layerIndex][sectionIndex]; 
+
+						verticies.resize(verticies.size() + 4, 
+							sf::Vertex(gs::Vec2f(), overlayColor)); 
+						applyVertexBounds(&verticies[verticies.size() - 4], 
+							position, size);
+						applyTextureBounds(textureIndex, 
+							&verticies[verticies.size() - 4], rotation); 
+					}
+				}; 
+
+				for (tilePosition.y = sectionIndex * Chunk::meshSectionHeight;
+					tilePosition.y < (sectionIndex + 1) * Chunk::meshSectionHeight;
 					tilePosition.y++) 
 				{
 					const Block block = chunk.getBlock(tilePosition);
+					const gs::Vec2f tileSpacePosition = gs::Vec2f(tilePosition); 
 
-					gs::Vec2f renderPosition = transformTilePosition(
-						tilePosition, chunk.offset
-					);
-					gs::Vec2f renderSize = scalePosition({ 1.0f, 1.0f }); 
-					int textureIndex = 0; 
-					int rotation = 0;
-
-					if (layerIndex > 0) {
-						const bool foreground = BlockInfo::getVar(
-							block.id, BlockInfo::foreground); 
-
-						if (layerIndex != (1 + static_cast<int>(foreground)))
-							continue; 
-						
-						if (block.getVar(BlockInfo::horizontalShift))
-							renderPosition.x += cameraScale 
-								* calculateHorizontalOffset(tilePosition); 
-						// Allows the fluids to change height, depending on
-						// the level. 
-						if (block.isFluid()) {
-							float offset = cameraScale 
-								* block.tags.fluidLevel * 2.0f; 
-
-							if (block.tags.fluidLevel == 0 
-								&& chunk.getBlockId(tilePosition 
-									- gs::Vec2i(0, 1)) != block.id)
-								offset = cameraScale; 
-
-							renderPosition.y += offset;
-							renderSize.y -= offset; 
-						}
-						else if (static_cast<BlockInfo::BlockDependencyType>(
-							block.getVar(BlockInfo::blockDependencyType))
-								== BlockInfo::BlockDependencyType::Crop)
-							renderPosition.y += cameraScale; 
+					// Walls are only visible behind transparent blocks. 
+					if (BlockInfo::getVar(block.id, BlockInfo::hasTransparency)) {
+						addTile(0, getWallTextureIndex(chunk.getWall(tilePosition)),
+							0, tileSpacePosition, { 1.0f, 1.0f }, false, false); 
+					}
 
-						textureIndex = getBlockTextureIndex(block); 
-						rotation = block.tags.rotation; 
+					const bool foreground = BlockInfo::getVar(
+						block.id, BlockInfo::foreground); 
+					gs::Vec2f renderPosition = tileSpacePosition; 
+					gs::Vec2f renderSize = gs::Vec2f(1.0f, 1.0f); 
+
+					if (block.getVar(BlockInfo::horizontalShift))
+						renderPosition.x += pixelSize 
+							* calculateHorizontalOffset(tilePosition); 
+					// Allows the fluids to change height, depending on
+					// the level. 
+					if (block.isFluid()) {
+						float offset = pixelSize * block.tags.fluidLevel * 2.0f; 
+
+						if (block.tags.fluidLevel == 0 
+							&& chunk.getBlockId(tilePosition 
+								- gs::Vec2i(0, 1)) != block.id)
+							offset = pixelSize; 
+
+						renderPosition.y += offset;
+						renderSize.y -= offset; 
 					}
-					else {
-						const Wall wall = chunk.getWall(tilePosition); 
+					else if (static_cast<BlockInfo::BlockDependencyType>(
+						block.getVar(BlockInfo::blockDependencyType))
+							== BlockInfo::BlockDependencyType::Crop)
+						renderPosition.y += pixelSize; 
+
+					addTile(1 + static_cast<int>(foreground), 
+						getBlockTextureIndex(block), block.tags.rotation,
+						renderPosition, renderSize, 
+						BlockInfo::getVar(block.id, BlockInfo::hasBlockOverlay), 
+						BlockInfo::getVar(block.id, BlockInfo::renderUnderside)
+					); 
 
-						if (!BlockInfo::getVar(block.id,
-								BlockInfo::hasTransparency))
-							continue; 
+					tilesBuilt++; 
+				}
+			}
 
-						textureIndex = getWallTextureIndex(wall); 
-					}
+			chunk.setMeshSectionBuilt(sectionIndex, true); 
 
-					// Makes sure the tiles texture exists. 
-					if (textureIndex != 0) {
-						bool renderBlockOverlay = false; 
-
-						if (isBlockLayer) {
-							renderBlockOverlay = BlockInfo::getVar(block.id, 
-								BlockInfo::hasBlockOverlay);
-
-							if (renderBlockOverlay) {
-								// Ignore normal block rendering if not required. 
-								if (!BlockInfo::getVar(block.id,
-										BlockInfo::renderUnderside))
-									goto RENDER_OVERLAY; 
-							}
-						}
+			return tilesBuilt; 
+		}
+		gs::Vec2i getRenderableMeshSectionRange() {
+			return gs::Vec2i(
+				renderableVerticalRange.x / Chunk::meshSectionHeight,
+				std::min((renderableVerticalRange.y - 1) 
+					/ Chunk::meshSectionHeight, Chunk::numOfMeshSections - 1)
+			); 
+		}
+		void buildVisibleChunkMeshes(const World& world) {
+			visibleChunks.clear(); 
+			visibleChunkMeshes.clear(); 
 
-						applyVertexBounds(
-							&tileVerticies[tileVertexIndex], renderPosition, 
-							renderSize
-						); 
-						applyTextureBounds(
-							textureIndex, &tileVerticies[tileVertexIndex], 
-							rotation
-						); 
-
-						tilesRendered++; 
-						tileVertexIndex += 4; 
-
-						if (renderBlockOverlay) [[unlikely]] {
-RENDER_OVERLAY:
-							for (int quad = 0; quad < 4; quad++) {
-								tileOverlayVerticies[tileOverlayVertexIndex
-									+ quad].color = overlayColor;
-							}
-
-							applyVertexBounds(
-								&tileOverlayVerticies[tileOverlayVertexIndex], 
-								renderPosition, renderSize
-							);
-							applyTextureBounds(
-								textureIndex, 
-								&tileOverlayVerticies[tileOverlayVertexIndex],
-								rotation
-							);
-
-							tileOverlayVertexIndex += 4;
-						}
-					}
+			// Mesh lookups modify the map, so they are done up front. 
+			for (int chunkOffset = renderableChunkRange.x; chunkOffset < 
+				renderableChunkRange.y; chunkOffset++) 
+			{
+				const Chunk* chunk = world.getChunk(chunkOffset);   
+
+				if (chunk == nullptr)
+					continue; 
+
+				ChunkMesh& chunkMesh = chunkMeshes[chunkOffset]; 
+
+				// Rebuilds everything if the chunk at this offset was reloaded. 
+				if (chunkMesh.chunk != chunk) {
+					chunkMesh.chunk = chunk; 
+					chunk->setImpostorBuilt(false); 
+
+					for (int sectionIndex = 0; sectionIndex < 
+						Chunk::numOfMeshSections; sectionIndex++)
+						chunk->setMeshSectionBuilt(sectionIndex, false); 
+				}
+
+				visibleChunks.push_back(chunk); 
+				visibleChunkMeshes.push_back(&chunkMesh); 
+			}
+
+			if (areImpostorsRendered()) {
+				buildVisibleChunkImpostors(); 
+				return; 
+			}
+
+			const gs::Vec2i sectionRange = getRenderableMeshSectionRange(); 
+			std::vector<int> chunkTilesRebuilt(visibleChunks.size(), 0); 
+
+			// Each chunk only touches it's own mesh, so they can be built
+			// independently. 
+			workerPool.parallelFor(visibleChunks.size(), [&](int chunkIndex) {
+				const Chunk& chunk = *visibleChunks[chunkIndex]; 
+
+				for (int sectionIndex = sectionRange.x; sectionIndex <= 
+					sectionRange.y; sectionIndex++) 
+				{
+					if (!chunk.isMeshSectionBuilt(sectionIndex))
+						chunkTilesRebuilt[chunkIndex] += buildChunkMeshSection(
+							chunk, *visibleChunkMeshes[chunkIndex], sectionIndex); 
+				}
+			}); 
+
+			for (int tilesBuilt : chunkTilesRebuilt)
+				tilesRebuilt += tilesBuilt; 
+		}
+		int getChunkLayerVertexCount(
+			const ChunkMesh& chunkMesh, int layerIndex, bool overlay) 
+		{
+			const gs::Vec2i sectionRange = getRenderableMeshSectionRange(); 
+			int numOfVerticies = 0; 
+
+			for (int sectionIndex = sectionRange.x; sectionIndex <= 
+				sectionRange.y; sectionIndex++) 
+			{
+				numOfVerticies += (overlay ? chunkMesh.tileOverlayVerticies
+					: chunkMesh.tileVerticies)[layerIndex][sectionIndex].size(); 
+			}
+
+			return numOfVerticies; 
+		}
+		void renderChunkLayer(
+			const ChunkMesh& chunkMesh, int chunkOffset, int layerIndex, 
+			bool overlay, sf::Vertex* verticies) 
+		{
+			const float tileScale = tileSize * cameraScale; 
+			const gs::Vec2f chunkPosition = gs::Vec2f(
+				(chunkOffset * Chunk::width * tileScale) - cameraPosition.x, 
+				-cameraPosition.y
+			); 
+			const gs::Vec2i sectionRange = getRenderableMeshSectionRange(); 
+
+			// Copies verticies into the frame, applying the camera transform.
+			for (int sectionIndex = sectionRange.x; sectionIndex <= 
+				sectionRange.y; sectionIndex++) 
+			{
+				const std::vector<sf::Vertex>& sectionVerticies = (overlay 
+					? chunkMesh.tileOverlayVerticies : chunkMesh.tileVerticies)
+						[layerIndex][sectionIndex]; 
+
+				for (const sf::Vertex& sectionVertex : sectionVerticies) {
+					sf::Vertex& vertex = *verticies++; 
+
+					vertex = sectionVertex; 
+					// Round to prevent pixel flipping. 
+					vertex.position.x = std::round(
+						(vertex.position.x * tileScale) + chunkPosition.x); 
+					vertex.position.y = std::round(
+						(vertex.position.y * tileScale) + chunkPosition.y); 
+				}
+			}
+		}
+		bool areImpostorsRendered() {
+			return cameraScale < impostorCameraScale; 
+		}
+		void createImpostorColors() {
+			// Pixel colors are picked randomly, so they are chosen once. 
+			for (int blockId = 0; blockId < Block::End; blockId++) {
+				blockImpostorColors[blockId] = getBlockPixelColor(
+					static_cast<Block::Id>(blockId)); 
+			}
+			for (int wallId = 0; wallId < Wall::End; wallId++) {
+				wallImpostorColors[wallId] = getWallPixelColor(
+					static_cast<Wall::Id>(wallId)); 
+			}
+		}
+		void buildChunkImpostor(const Chunk& chunk, ChunkMesh& chunkMesh) {
+			chunkMesh.impostorPixels.resize(Chunk::width * Chunk::height * 4); 
+
+			gs::Vec2i tilePosition; 
+
+			for (tilePosition.y = 0; tilePosition.y < Chunk::height; 
+				tilePosition.y++) 
+			{
+				for (tilePosition.x = 0; tilePosition.x < Chunk::width; 
+					tilePosition.x++) 
+				{
+					const Block block = chunk.getBlock(tilePosition); 
+					const Wall wall = chunk.getWall(tilePosition); 
+
+					gs::Color color = gs::Color::Transparent; 
+
+					// Blocks cover walls, and air shows the sky. 
+					if (!block.isEmpty())
+						color = blockImpostorColors[block.id]; 
+					else if (!wall.isEmpty())
+						color = wallImpostorColors[wall.id]; 
+
+					sf::Uint8* pixel = &chunkMesh.impostorPixels[
+						((tilePosition.y * Chunk::width) + tilePosition.x) * 4]; 
+
+					pixel[0] = color.r; 
+					pixel[1] = color.g; 
+					pixel[2] = color.b; 
+					pixel[3] = color.a; 
 				}
 			}
+
+			chunk.setImpostorBuilt(true); 
+		}
+		void buildVisibleChunkImpostors() {
+			std::vector<int> staleChunkIndices; 
+
+			for (int chunkIndex = 0; chunkIndex < visibleChunks.size(); 
+				chunkIndex++) 
+			{
+				if (!visibleChunks[chunkIndex]->isImpostorBuilt())
+					staleChunkIndices.push_back(chunkIndex); 
+			}
+
+			workerPool.parallelFor(staleChunkIndices.size(), [&](int index) {
+				const int chunkIndex = staleChunkIndices[index]; 
+
+				buildChunkImpostor(*visibleChunks[chunkIndex], 
+					*visibleChunkMeshes[chunkIndex]); 
+			}); 
+
+			// Textures can only be uploaded from the render thread. 
+			for (int chunkIndex : staleChunkIndices) {
+				ChunkMesh& chunkMesh = *visibleChunkMeshes[chunkIndex]; 
+
+				if (chunkMesh.impostorTexture.getSize().x == 0)
+					chunkMesh.impostorTexture.create(Chunk::width, Chunk::height); 
+
+				chunkMesh.impostorTexture.update(chunkMesh.impostorPixels.data()); 
+				tilesRebuilt += Chunk::width * Chunk::height; 
+			}
+		}
+		void renderChunkImpostors() {
+			impostorSprite.setScale(scalePosition({ 1.0f, 1.0f })); 
+
+			for (int chunkIndex = 0; chunkIndex < visibleChunks.size(); 
+				chunkIndex++) 
+			{
+				impostorSprite.setTexture(
+					visibleChunkMeshes[chunkIndex]->impostorTexture); 
+				impostorSprite.setTextureRect(sf::IntRect(
+					0, renderableVerticalRange.x, Chunk::width, 
+					renderableVerticalRange.y - renderableVerticalRange.x
+				)); 
+				impostorSprite.setPosition(transformTilePosition(
+					gs::Vec2i(0, renderableVerticalRange.x), 
+					visibleChunks[chunkIndex]->offset
+				)); 
+
+				worldRenderTexture.draw(impostorSprite); 
+				drawCalls++; 
+				tilesRendered += Chunk::width 
+					* (renderableVerticalRange.y - renderableVerticalRange.x); 
+			}
 		}
 		void renderWalls(const World& world) {
 			renderWorldLayer(world, 0); 
@@ -825,39 +1221,128 @@ RENDER_OVERLAY:
 		void renderWorldLayer(const World& world, int layerIndex) {
 			const bool isBlockLayer = layerIndex > 0;
 
-			tileVertexIndex = 0; 
-			tileOverlayVertexIndex = 0; 
-
 			if (layerIndex == 0) {
 				worldRenderTexture.clear(gs::Color::Transparent); 
 				tilesRendered = 0;
+				tilesRebuilt = 0; 
+				tileVertexArena.clear(); 
+				tileOverlayVertexArena.clear(); 
+
+				// Drops the meshes of chunks well outside of view. 
+				for (auto chunkMesh = chunkMeshes.begin(); 
+					chunkMesh != chunkMeshes.end();) 
+				{
+					if (chunkMesh->first < renderableChunkRange.x - 2
+						|| chunkMesh->first >= renderableChunkRange.y + 2)
+						chunkMesh = chunkMeshes.erase(chunkMesh); 
+					else
+						chunkMesh++; 
+				}
+
+				buildVisibleChunkMeshes(world); 
 			}
 
-			for (int chunkOffset = renderableChunkRange.x; chunkOffset < 
-				renderableChunkRange.y; chunkOffset++) 
-			{
-				const Chunk* chunk = world.getChunk(chunkOffset);   
+			if (areImpostorsRendered()) {
+				// Impostors include every layer. 
+				if (layerIndex == 0)
+					renderChunkImpostors(); 
 
-				if (chunk != nullptr)
-					renderChunkLayer(*chunk, layerIndex); 
+				return; 
 			}
 
-			worldRenderTexture.draw(
-				tileVerticies, tileVertexIndex, sf::Quads,
-				&(layerIndex == 0 ? wallAtlas : blockAtlas)
-			);
+			const int numOfChunks = visibleChunks.size(); 
+
+			// Sizes the output of each chunk with a prefix sum, so chunks can 
+			// be written in parallel. 
+			chunkVertexOffsets.assign(numOfChunks + 1, gs::Vec2i()); 
+
+			for (int chunkIndex = 0; chunkIndex < numOfChunks; chunkIndex++) {
+				const ChunkMesh& chunkMesh = *visibleChunkMeshes[chunkIndex]; 
+
+				chunkVertexOffsets[chunkIndex + 1] = chunkVertexOffsets[chunkIndex]
+					+ gs::Vec2i(
+						getChunkLayerVertexCount(chunkMesh, layerIndex, false),
+						getChunkLayerVertexCount(chunkMesh, layerIndex, true)
+					); 
+			}
+
+			const gs::Vec2i numOfVerticies = chunkVertexOffsets[numOfChunks]; 
+
+			// Each layer is drawn as it's own batch. 
+			VertexArena::Batch tileBatch = tileVertexArena.beginBatch(); 
+			VertexArena::Batch tileOverlayBatch = 
+				tileOverlayVertexArena.beginBatch(); 
+			sf::Vertex* tileVerticies = 
+				tileVertexArena.allocate(numOfVerticies.x); 
+			sf::Vertex* tileOverlayVerticies = 
+				tileOverlayVertexArena.allocate(numOfVerticies.y); 
+
+			workerPool.parallelFor(numOfChunks, [&](int chunkIndex) {
+				const ChunkMesh& chunkMesh = *visibleChunkMeshes[chunkIndex]; 
+				const int chunkOffset = visibleChunks[chunkIndex]->offset; 
+
+				renderChunkLayer(chunkMesh, chunkOffset, layerIndex, false, 
+					tileVerticies + chunkVertexOffsets[chunkIndex].x); 
+				renderChunkLayer(chunkMesh, chunkOffset, layerIndex, true, 
+					tileOverlayVerticies + chunkVertexOffsets[chunkIndex].y); 
+			}); 
+
+			tilesRendered += numOfVerticies.x / 4; 
+
+			tileVertexArena.endBatch(tileBatch); 
+			tileOverlayVertexArena.endBatch(tileOverlayBatch); 
+
+			tileVertexArena.draw(worldRenderTexture, tileBatch, 
+				&(layerIndex == 0 ? wallAtlas : blockAtlas));
+			drawCalls++; 
 
 			if (isBlockLayer) {
 				// Render block overlay. 
-				worldRenderTexture.draw(
-					tileOverlayVerticies, tileOverlayVertexIndex, sf::Quads,
-					&blockOverlayAtlas
-				);
+				tileOverlayVertexArena.draw(worldRenderTexture, 
+					tileOverlayBatch, &blockOverlayAtlas);
+				drawCalls++; 
+			}
+		}
+		void addEntityQuad(
+			sf::IntRect textureBounds, gs::Vec2f position, gs::Vec2f origin, 
+			gs::Vec2f scale, float rotation, gs::Color color)
+		{
+			// Same transform a sprite would use, baked into the verticies. 
+			sf::Transform transform; 
+
+			transform.translate(position.x, position.y);
+			transform.rotate(rotation); 
+			transform.scale(scale.x, scale.y); 
+			transform.translate(-origin.x, -origin.y); 
+
+			const gs::Vec2f size = gs::Vec2f(
+				textureBounds.width, textureBounds.height); 
+			const gs::Vec2f corners[4] = {
+				gs::Vec2f(0.0f, 0.0f), gs::Vec2f(size.x, 0.0f), 
+				size, gs::Vec2f(0.0f, size.y)
+			};
+
+			sf::Vertex* quads = entityVertexArena.allocate(4); 
+
+			for (int quad = 0; quad < 4; quad++) {
+				quads[quad].position = transform.transformPoint(corners[quad]); 
+				quads[quad].texCoords = gs::Vec2f(
+					textureBounds.left, textureBounds.top) + corners[quad];
+				quads[quad].color = color; 
+			}
+		}
+		void flushEntityQuads(sf::RenderTarget& target) {
+			VertexArena::Batch entityBatch = { 0, entityVertexArena.getSize() }; 
+
+			if (entityBatch.count > 0) {
+				entityVertexArena.draw(target, entityBatch, &entityAtlas); 
+				drawCalls++; 
 			}
+
+			entityVertexArena.clear(); 
 		}
 		void renderEntitySegment(
-			const Entity& entity, int segmentIndex, int textureOffset, 
-			bool flip, sf::RenderTarget& target)
+			const Entity& entity, int segmentIndex, int textureOffset, bool flip)
 		{
 			const Model::Id modelId = entity.modelTransform.id; 
 			// The static segment object being rendered. 
@@ -866,33 +1351,19 @@ RENDER_OVERLAY:
 			// The information that transforms and animates the segment. 
 			const ModelTransform::SegmentTransform& segmentTransform = 
 				entity.modelTransform.transforms[segmentIndex]; 
-
-			entitySegmentSprite.setScale(cameraScale, cameraScale); 
-			entitySegmentSprite.setTexture(
-				entitySegmentTextures[modelId]
-					[segment.textureIndex + textureOffset]
-			);
-			resizeSpriteBounds(entitySegmentSprite); 
-
-			entitySegmentSprite.setOrigin(gs::Vec2f(
-				flip ? entitySegmentSprite.getTexture()->getSize().x 
-					- segment.origin.x : segment.origin.x,
-				segment.origin.y
-			)); 
-			entitySegmentSprite.setPosition(transformPosition(
-				entity.position + gs::Vec2f(segment.position.x 
-					* (flip ? -1.0f : 1.0f), segment.position.y)
-			)); 
-			entitySegmentSprite.setRotation(
-				segment.rotation + segmentTransform.angle
-			); 
-			entitySegmentSprite.setColor(
+			const sf::IntRect& textureBounds = entitySegmentTextureBounds
+				[modelId][segment.textureIndex + textureOffset]; 
+
+			addEntityQuad(
+				textureBounds, 
+				transformPosition(entity.position + gs::Vec2f(segment.position.x 
+					* (flip ? -1.0f : 1.0f), segment.position.y)), 
+				gs::Vec2f(flip ? textureBounds.width - segment.origin.x 
+					: segment.origin.x, segment.origin.y), 
+				gs::Vec2f(cameraScale, cameraScale), 
+				segment.rotation + segmentTransform.angle, 
 				segment.color * segmentTransform.color
-			);
-
-			target.draw(entitySegmentSprite);
-
-			entitySegmentSprite.setColor(gs::Color::White); 
+			); 
 		}
 		void renderHeldItem(
 			Entity& entity, Item item, ModelTransform::Segments segment) 
@@ -931,22 +1402,11 @@ RENDER_OVERLAY:
 			const bool flipItem = animationAngle < 0.0f;
 			animationAngle = std::abs(animationAngle);
 
-			ui::itemSprite.setScale(
-				ui::itemSprite.getScale().x * -1.0f,
-				ui::itemSprite.getScale().y * scaler
-				* (flipItem ? -1.0f : 1.0f)
-			);
-			ui::itemSprite.setRotation(
+			renderItemEntity(
+				heldItem, false, 
+				gs::Vec2f(-1.0f, scaler * (flipItem ? -1.0f : 1.0f)), 
 				itemAngle + animationAngle * scaler
 			);
-
-			renderItemEntity(heldItem, false);
-
-			ui::itemSprite.setScale(
-				std::abs(ui::itemSprite.getScale().x),
-				std::abs(ui::itemSprite.getScale().y)
-			);
-			ui::itemSprite.setRotation(0.0f);
 		}
 		void renderPlayerEntity(Player& playerEntity, sf::RenderTarget& target) {
 			const float scaler = playerEntity.modelTransform.facingForward 
@@ -982,6 +1442,10 @@ RENDER_OVERLAY:
 					!playerEntity.modelTransform.facingForward
 				);
 			}
+
+			// Previews outside of the world are drawn straight away. 
+			if (&target != &worldRenderTexture)
+				flushEntityQuads(target); 
 		}
 		void renderMobEntity(Mob& mobEntity) {
 			for (int segmentIndex = 0; segmentIndex < 
@@ -1005,7 +1469,10 @@ RENDER_OVERLAY:
 				);
 			}
 		}
-		void renderItemEntity(const ItemEntity& itemEntity, bool applySin) {
+		void renderItemEntity(
+			const ItemEntity& itemEntity, bool applySin, gs::Vec2f flip, 
+			float rotation) 
+		{
 			// Item's vertical offset center. 
 			const float distanceOffGround = (1.0f - itemEntity.size.y) / 4.0f;
 			// Calculates how high off of the ground the item should hover. 
@@ -1019,149 +1486,189 @@ RENDER_OVERLAY:
 					+ (applySin ? -distanceOffGround + verticalOffset : 0.0f)
 			));
 
-			ui::renderItem(
-				itemEntity.itemContainer.item, renderPosition,
-				scaleValue(itemEntity.size.x), worldRenderTexture
+			const Item& item = itemEntity.itemContainer.item; 
+			float size = scaleValue(itemEntity.size.x); 
+
+			// Items from the item atlas are drawn slightly bigger. 
+			if (item.getVar(ItemInfo::textureIndex) < ItemInfo::defaultTileItems)
+				size *= 1.4f; 
+
+			const float normalizedSize = size / tileSize; 
+
+			addEntityQuad(
+				getItemTextureBounds(item), renderPosition, 
+				gs::Vec2f(tileSize * 0.5f, tileSize * 0.5f), 
+				flip * normalizedSize, rotation
 			); 
 		}
 		void renderProjectileEntity(const ProjectileEntity& projectileEntity) {
-			entitySegmentSprite.setTexture(
-				entitySegmentTextures[Model::Arrow][0]
+			const sf::IntRect& textureBounds = 
+				entitySegmentTextureBounds[Model::Arrow][0]; 
+
+			addEntityQuad(
+				textureBounds, transformPosition(projectileEntity.position),
+				gs::Vec2f(textureBounds.width, textureBounds.height) * 0.5f, 
+				gs::Vec2f(cameraScale, cameraScale), projectileEntity.angle, 
+				gs::Color(255, 255, 255, 
+					std::min(projectileEntity.timeLeft * 5, 255))
 			); 
-			resizeSpriteBounds(entitySegmentSprite); 
-
-			entitySegmentSprite.setOrigin(
-				gs::Vec2f(entitySegmentSprite.getTexture()->getSize()) * 0.5f
-			); 
-			entitySegmentSprite.setPosition(
-				transformPosition(projectileEntity.position)
+		}
+		void renderEntities() {
+			// Each entity type is drawn from it's own pool. 
+			if (!ui::gameOver)
+				renderPlayerEntity(*player); 
+
+			for (Mob& mobEntity : mobs)
+				renderMobEntity(mobEntity); 
+			for (const ItemEntity& itemEntity : itemEntities)
+				renderItemEntity(itemEntity); 
+			for (const ProjectileEntity& projectileEntity : projectileEntities)
+				renderProjectileEntity(projectileEntity); 
+
+			flushEntityQuads(worldRenderTexture); 
+		}
+		void renderParticle(int particleIndex) {
+			const gs::Vec2f position = gs::Vec2f(
+				particleStore.positionsX[particleIndex], 
+				particleStore.positionsY[particleIndex]
 			); 
-			entitySegmentSprite.setRotation(projectileEntity.angle); 
-			entitySegmentSprite.setColor(gs::Color(
-				255, 255, 255, std::min(projectileEntity.timeLeft * 5, 255)
-			)); 
 
-			worldRenderTexture.draw(entitySegmentSprite); 
-
-			entitySegmentSprite.setRotation(0.0f); 
-			entitySegmentSprite.setColor(gs::Color::White); 
-		}
-		void renderEntity(const EntityPair& entity) {
-			// Call render function corresponding to the entity type. 
-			switch (entity.first) {
-			case Entity::Type::PlayerEntity:
-				if (!ui::gameOver)
-					renderPlayerEntity(dynamic_cast<Player&>(*entity.second)); 
-				break; 
-			case Entity::Type::Mob:
-				renderMobEntity(dynamic_cast<Mob&>(*entity.second)); 
-				break; 
-			case Entity::Type::ItemEntity:
-				renderItemEntity(
-					dynamic_cast<const ItemEntity&>(*entity.second)
-				); 
-				break; 
-			case Entity::Type::ProjectileEntity:
-				renderProjectileEntity(
-					dynamic_cast<const ProjectileEntity&>(*entity.second)
+			sf::Vertex* quads = particleVertexArena.allocate(4); 
+
+			applyVertexBounds(quads, transformPosition(position), 
+				scalePosition(particleStore.sizes[particleIndex]), 
+				particleStore.rotations[particleIndex]); 
+
+			for (int quad = 0; quad < 4; quad++)
+				quads[quad].color = particleStore.colors[particleIndex]; 
+
+			particlesRendered++;
+		}
+		void renderStar(const Particle& star) {
+			const float transparencyScaler = 1.0f - (star.position.y 
+				/ Particle::starLowerHorizon);
+			float transparency = star.color.a * transparencyScaler; 
+
+			gs::util::approach(&transparency, 0.0f, 100.0f - starBrightness); 
+
+			sf::Vertex* quads = particleVertexArena.allocate(4); 
+
+			applyVertexBounds(quads, star.position, star.size, star.rotation); 
+
+			for (int quad = 0; quad < 4; quad++) {
+				quads[quad].color = gs::Color(
+					star.color.r, star.color.g, star.color.b, transparency
 				); 
-				break; 
 			}
+
+			particlesRendered++;
 		}
-		void renderEntities() {
-			for (auto& entity : entities) {
-				renderEntity(entity); 
-			}
+		void renderDamageText(const DamageText& damageText) {
+			const float transparency = std::min(
+				damageText.timeRemaining * 10.0f, 255.0f
+			); 
+			const gs::Vec2f position = gs::Vec2f(
+				damageText.position.x, damageText.position.y + std::sin(
+					static_cast<float>(damageText.timeRemaining) / 10.0f) * 0.1f
+			); 
+			const gs::Color& color = damageText.color; 
+
+			renderDamageText(
+				damageText.string, transformPosition(position), 
+				// Scales text with the camera's scale. 
+				cameraScale / 6.0f, 
+				gs::Color(color.r, color.g, color.b, transparency)
+			); 
 		}
-		void renderParticle(const Particle& particle) {
-			static sf::RectangleShape particleBox; 
-			static sf::Text particleText; 
-
-			switch (particle.type) {
-			case Particle::Type::Generic:
-				particleBox.setSize(scalePosition(particle.size)); 
-				particleBox.setOrigin(particleBox.getSize() * 0.5f);
-				particleBox.setPosition(transformPosition(particle.position));
-				particleBox.setRotation(particle.rotation); 
-				particleBox.setFillColor(particle.color); 
-
-				worldRenderTexture.draw(particleBox);
-				break; 
-			case Particle::Type::Star: 
-			{
-				const float transparencyScaler = 1.0f - (particle.position.y 
-					/ Particle::starLowerHorizon);
-				float transparency = particle.color.a * transparencyScaler; 
-
-				gs::util::approach(&transparency, 0.0f, 100.0f - starBrightness); 
-
-				particleBox.setSize(particle.size);
-				particleBox.setOrigin(particleBox.getSize() * 0.5f);
-				particleBox.setPosition(particle.position);
-				particleBox.setRotation(particle.rotation);
-				particleBox.setFillColor(gs::Color(
-					particle.color.r, particle.color.g, particle.color.b,
-					transparency
-				)); 
-					
-				window::winmain->draw(particleBox);
+		void renderDamageText(
+			const std::string& string, gs::Vec2f position, float scale, 
+			gs::Color color) 
+		{
+			const sf::Font& font = ui::fonts[0]; 
+
+			// Looks up the glyphs once, rather than building text every frame. 
+			if (!damageTextGlyphsCached) {
+				for (int glyphIndex = 0; glyphIndex < numOfDamageTextGlyphs; 
+					glyphIndex++) 
+				{
+					damageTextGlyphs[glyphIndex] = font.getGlyph(
+						damageTextCharacters[glyphIndex], 
+						damageTextCharacterSize, false
+					); 
+				}
+
+				damageTextGlyphsCached = true; 
 			}
-				break; 
-			case Particle::Type::DamagePoint:
-			{
-				const float transparency = std::min(
-					particle.timeRemaining * 10.0f, 255.0f
-				); 
-				const gs::Vec2f position = gs::Vec2f(
-					particle.position.x, particle.position.y + std::sin(
-						static_cast<float>(particle.timeRemaining) / 10.0f) * 0.1f
-				); 
 
-				particleText.setFont(ui::fonts[0]); 
-				particleText.setString(particle.string); 
-				particleText.setPosition(transformPosition(position)); 
-				particleText.setScale(gs::Vec2f(
-					// Scales text with the camera's scale. 
-					cameraScale / 6.0f, cameraScale / 6.0f)
-				); 
-				particleText.setFillColor(gs::Color(
-					particle.color.r, particle.color.g, particle.color.b, 
-					transparency
-				)); 
+			// Glyphs are placed relative to the baseline of the first line. 
+			gs::Vec2f pen = gs::Vec2f(0.0f, damageTextCharacterSize); 
+
+			for (char character : string) {
+				const std::size_t glyphIndex = 
+					std::string_view(damageTextCharacters).find(character); 
 
-				window::winmain->draw(particleText); 
+				if (glyphIndex == std::string_view::npos)
+					continue; 
+
+				const sf::Glyph& glyph = damageTextGlyphs[glyphIndex]; 
+				const sf::IntRect& textureBounds = glyph.textureRect; 
+
+				sf::Vertex* quads = damageTextVertexArena.allocate(4); 
+
+				applyVertexBounds(quads, position + ((pen + gs::Vec2f(
+					glyph.bounds.left, glyph.bounds.top)) * scale), 
+					gs::Vec2f(glyph.bounds.width, glyph.bounds.height) * scale); 
+				applyTextureBounds(quads, textureBounds); 
+
+				for (int quad = 0; quad < 4; quad++)
+					quads[quad].color = color; 
+
+				pen.x += glyph.advance; 
 			}
-				break; 
+		}
+		void flushParticleQuads(sf::RenderTarget& target) {
+			VertexArena::Batch particleBatch = 
+				{ 0, particleVertexArena.getSize() }; 
+			VertexArena::Batch damageTextBatch = 
+				{ 0, damageTextVertexArena.getSize() }; 
+
+			if (particleBatch.count > 0) {
+				particleVertexArena.draw(target, particleBatch); 
+				drawCalls++; 
 			}
-			
-			particlesRendered++; 
+			if (damageTextBatch.count > 0) {
+				damageTextVertexArena.draw(target, damageTextBatch, 
+					&ui::fonts[0].getTexture(damageTextCharacterSize)); 
+				drawCalls++; 
+			}
+
+			particleVertexArena.clear(); 
+			damageTextVertexArena.clear(); 
 		}
 		void renderUnlitParticles() {
 			if (!shouldParticlesBeRendered)
 				return;
 
-			for (auto& particle : particles) {
-				const bool litParticle =
-					Particle::litParticles[static_cast<int>(particle.type)];
+			for (const auto& damageText : damageTexts) 
+				renderDamageText(damageText); 
 
-				if (particle.active && !litParticle 
-						&& particle.type != Particle::Type::Star)
-					renderParticle(particle);
-			}
+			flushParticleQuads(*window::winmain); 
 		}
 		void renderLitParticles() {
 			if (!shouldParticlesBeRendered)
 				return; 
 
-			for (auto& particle : particles) {
-				const bool litParticle = 
-					Particle::litParticles[static_cast<int>(particle.type)]; 
-
-				if (particle.active && litParticle) 
-					renderParticle(particle);
+			for (int particleIndex = 0; particleIndex < 
+				particleStore.numOfParticles; particleIndex++)
+			{
+				renderParticle(particleIndex);
 			}
+
+			flushParticleQuads(worldRenderTexture); 
 		}
-		void renderChunkLightMap(const Chunk& chunk, const World& world) {
+		int renderChunkLightMap(
+			const Chunk& chunk, const World& world, sf::Vertex* verticies) 
+		{
 			auto blendQuad = [&](gs::Vec2i position) -> TileColor {
 				// Stores the sum of each component. 
 				int colorValues[3] = { 0, 0, 0 };
@@ -1192,6 +1699,7 @@ RENDER_OVERLAY:
 				); 
 			};
 
+			int numOfVerticies = 0; 
 			gs::Vec2i tilePosition;
 
 			for (tilePosition.x = 0; tilePosition.x < Chunk::width;
@@ -1205,78 +1713,196 @@ RENDER_OVERLAY:
 						tilePosition, chunk.offset);
 					const TileColor tileColor = chunk.getTileColor(tilePosition);
 
+					TileColor quadColors[4]; 
+
 					switch (lighting::lightingStyle) {
 					case lighting::LightingStyle::Geometry:
 						if (tileColor == lighting::ambientLightColor)
 							continue;  
 
 						for (int quad = 0; quad < 4; quad++)
-							lightMapVerticies[lightVertexIndex + quad].color = tileColor; 
+							quadColors[quad] = tileColor; 
 
 						break;
-					case lighting::LightingStyle::Smooth:
+					default:
 					{
 						const gs::Vec2i positionInWorld = gs::Vec2i(
 							tilePosition.x + (chunk.offset * Chunk::width),
 							tilePosition.y
 						);
 
-						lightMapVerticies[lightVertexIndex + 0].color = blendQuad(
+						quadColors[0] = blendQuad(
 							positionInWorld + gs::Vec2i(-1, -1));
-						lightMapVerticies[lightVertexIndex + 1].color = blendQuad(
+						quadColors[1] = blendQuad(
 							positionInWorld + gs::Vec2i(0, -1));
-						lightMapVerticies[lightVertexIndex + 2].color = blendQuad(
+						quadColors[2] = blendQuad(
 							positionInWorld + gs::Vec2i(0, 0));
-						lightMapVerticies[lightVertexIndex + 3].color = blendQuad(
+						quadColors[3] = blendQuad(
 							positionInWorld + gs::Vec2i(-1, 0)); 
-
-						// Stops rendering if completely dark. 
-						for (int offset = 0; offset < 4; offset++) {
-							if (lightMapVerticies[lightVertexIndex + offset].color
-									!= lighting::ambientLightColor)
-								continue;
-						}
 					}
 						break;
 					}
 
-					applyVertexBounds(
-						&lightMapVerticies[lightVertexIndex], renderPosition,
-						scalePosition({ 1.0f, 1.0f })
-					); 
+					for (int quad = 0; quad < 4; quad++)
+						verticies[numOfVerticies + quad].color = quadColors[quad]; 
+
+					applyVertexBounds(&verticies[numOfVerticies], renderPosition,
+						scalePosition({ 1.0f, 1.0f })); 
 
 					// Each square is composed of 4 quads, so add 4. 
-					lightVertexIndex += 4;
+					numOfVerticies += 4; 
 				}
 			}
+
+			return numOfVerticies; 
 		}
-		void renderWorldLightMap(const World& world) {
-			if (lighting::fullBrightEnabled)
-				return; 
+		void fillChunkLightMapPixels(const Chunk& chunk, int pixelColumn) {
+			gs::Vec2i tilePosition;
 
-			lightMap.clear(lighting::ambientLightColor); 
+			for (tilePosition.x = 0; tilePosition.x < Chunk::width;
+				tilePosition.x++)
+			{
+				// Each pixel is 4 bytes, stored in rows. 
+				sf::Uint8* pixel = &lightMapPixels[
+					(pixelColumn + tilePosition.x) * 4];
+
+				for (tilePosition.y = renderableVerticalRange.x;
+					tilePosition.y < renderableVerticalRange.y;
+					tilePosition.y++)
+				{
+					const TileColor tileColor = chunk.getTileColor(tilePosition);
+
+					pixel[0] = tileColor.r; 
+					pixel[1] = tileColor.g; 
+					pixel[2] = tileColor.b; 
+					pixel[3] = 255; 
 
-			lightVertexIndex = 0; 
+					pixel += lightMapPixelsSize.x * 4; 
+				}
+			}
+		}
+		void renderLightMapTexture(const World& world) {
+			lightMapPixelsSize = gs::Vec2i(
+				(renderableChunkRange.y - renderableChunkRange.x) * Chunk::width, 
+				std::max(renderableVerticalRange.y - renderableVerticalRange.x, 1)
+			); 
+			lightMapPixels.assign(lightMapPixelsSize.x * lightMapPixelsSize.y * 4, 255); 
 
 			for (int chunkOffset = renderableChunkRange.x; chunkOffset <
 				renderableChunkRange.y; chunkOffset++)
 			{
 				const Chunk* chunk = world.getChunk(chunkOffset);
+				const int pixelColumn = 
+					(chunkOffset - renderableChunkRange.x) * Chunk::width; 
 
 				if (chunk != nullptr)
-					renderChunkLightMap(*chunk, world); 
+					fillChunkLightMapPixels(*chunk, pixelColumn); 
+				else {
+					// Unloaded chunks are left at ambient light. 
+					for (int ypos = 0; ypos < lightMapPixelsSize.y; ypos++) {
+						for (int xpos = pixelColumn; xpos < pixelColumn 
+							+ Chunk::width; xpos++) 
+						{
+							sf::Uint8* pixel = &lightMapPixels[
+								((ypos * lightMapPixelsSize.x) + xpos) * 4]; 
+
+							pixel[0] = lighting::ambientLightColor.r; 
+							pixel[1] = lighting::ambientLightColor.g; 
+							pixel[2] = lighting::ambientLightColor.b; 
+						}
+					}
+				}
+			}
+
+			const gs::Vec2u textureSize = lightMapTexture.getSize(); 
+
+			// Only reallocates the texture when it needs to grow. 
+			if (textureSize.x < lightMapPixelsSize.x 
+				|| textureSize.y < lightMapPixelsSize.y) 
+			{
+				lightMapTexture.create(
+					std::max<int>(textureSize.x, lightMapPixelsSize.x), 
+					std::max<int>(textureSize.y, lightMapPixelsSize.y)
+				);
+				lightMapTexture.setSmooth(true); 
+				lightMapTextureSprite.setTexture(lightMapTexture); 
+			}
+
+			lightMapTexture.update(lightMapPixels.data(), lightMapPixelsSize.x,
+				lightMapPixelsSize.y, 0, 0); 
+			lightMapTextureSprite.setTextureRect(sf::IntRect(
+				0, 0, lightMapPixelsSize.x, lightMapPixelsSize.y));
+			lightMapTextureSprite.setPosition(transformTilePosition(
+				gs::Vec2i(0, renderableVerticalRange.x), renderableChunkRange.x
+			)); 
+			lightMapTextureSprite.setScale(scalePosition({ 1.0f, 1.0f })); 
+
+			lightMap.draw(lightMapTextureSprite); 
+			drawCalls++; 
+		}
+		void renderWorldLightMap(const World& world) {
+			if (lighting::fullBrightEnabled)
+				return; 
+
+			lightMap.clear(lighting::ambientLightColor); 
+
+			// Impostors have one pixel per tile, so the lighting matches them. 
+			if (lighting::lightingStyle == lighting::LightingStyle::Texture
+				|| areImpostorsRendered()) 
+			{
+				renderLightMapTexture(world); 
+				return; 
+			}
+
+			const int numOfChunks = visibleChunks.size(); 
+			// Geometry lighting skips unlit tiles, so each chunk is given room
+			// for every tile and packed afterwards. 
+			const int maxVerticiesPerChunk = Chunk::width * 4 * std::max(
+				renderableVerticalRange.y - renderableVerticalRange.x, 0); 
+
+			lightMapVertexArena.clear(); 
+
+			VertexArena::Batch lightMapBatch = lightMapVertexArena.beginBatch(); 
+			sf::Vertex* lightMapVerticies = lightMapVertexArena.allocate(
+				maxVerticiesPerChunk * numOfChunks); 
+
+			chunkLightVertexCounts.assign(numOfChunks, 0); 
+
+			workerPool.parallelFor(numOfChunks, [&](int chunkIndex) {
+				chunkLightVertexCounts[chunkIndex] = renderChunkLightMap(
+					*visibleChunks[chunkIndex], world, 
+					lightMapVerticies + (chunkIndex * maxVerticiesPerChunk)
+				);
+			}); 
+
+			int numOfVerticies = 0; 
+
+			for (int chunkIndex = 0; chunkIndex < numOfChunks; chunkIndex++) {
+				const sf::Vertex* chunkVerticies = 
+					lightMapVerticies + (chunkIndex * maxVerticiesPerChunk); 
+
+				std::copy(chunkVerticies, chunkVerticies 
+					+ chunkLightVertexCounts[chunkIndex], 
+					lightMapVerticies + numOfVerticies); 
+				numOfVerticies += chunkLightVertexCounts[chunkIndex]; 
 			}
 
-			lightMap.draw(lightMapVerticies, lightVertexIndex, sf::Quads); 
+			lightMapVertexArena.deallocate(
+				(maxVerticiesPerChunk * numOfChunks) - numOfVerticies); 
+			lightMapVertexArena.endBatch(lightMapBatch); 
+			lightMapVertexArena.draw(lightMap, lightMapBatch); 
+			drawCalls++; 
 		}
 		void finishWorldRendering() {
 			if (!lighting::fullBrightEnabled) {
 				lightMap.display(); 
 				worldRenderTexture.draw(lightMapSprite, sf::BlendMultiply); 
+				drawCalls++; 
 			}
 
 			worldRenderTexture.display(); 
 			window::winmain->draw(worldRenderTextureSprite); 
+			drawCalls++; 
 		}
 	}
 }
\ No newline at end of file
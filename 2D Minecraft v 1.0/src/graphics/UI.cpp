@@ -19,6 +19,8 @@ namespace engine {
 			gs::Color textBackgroundColor = gs::Color::Transparent;
 			bool textSharpen = false;
 			sf::FloatRect prvsTextBounds;
+			bool textShadow = false; 
+			std::unordered_map<std::size_t, RetainedText> retainedTexts; 
 			bool displayDebugMenu = false;
 			bool hideUIMenu = false; 
 			std::string fpsString;
@@ -65,11 +67,235 @@ namespace engine {
 				); 
 				renderText(string, position, centered); 
 			}
+			void setTextShadow(bool shadow) {
+				text.setShadow(shadow); 
+				textShadow = shadow; 
+			}
+			void layoutRetainedText(RetainedText& retainedText) {
+				const TextStyle& style = retainedText.style; 
+				const sf::Font& font = *style.font; 
+				const float outlineThickness = std::abs(style.outlineThickness); 
+				const float whitespaceWidth = font.getGlyph(
+					L' ', style.characterSize, false).advance; 
+				const float lineSpacing = font.getLineSpacing(style.characterSize); 
+
+				std::vector<sf::Vertex> fillVerticies; 
+
+				// Adds a quad for a glyph, padded like sf::Text does. 
+				auto addGlyphQuad = [](std::vector<sf::Vertex>& verticies, 
+					gs::Vec2f position, gs::Color color, const sf::Glyph& glyph) 
+				{
+					const float padding = 1.0f; 
+					const sf::FloatRect& bounds = glyph.bounds; 
+					const sf::IntRect& textureRect = glyph.textureRect; 
+
+					verticies.resize(verticies.size() + 4, 
+						sf::Vertex(gs::Vec2f(), color)); 
+
+					sf::Vertex* quads = &verticies[verticies.size() - 4]; 
+
+					applyVertexBounds(quads, position + gs::Vec2f(
+						bounds.left - padding, bounds.top - padding), gs::Vec2f(
+						bounds.width + (padding * 2.0f), 
+						bounds.height + (padding * 2.0f))); 
+					applyTextureBounds(quads, sf::IntRect(
+						textureRect.left - padding, textureRect.top - padding, 
+						textureRect.width + (padding * 2.0f), 
+						textureRect.height + (padding * 2.0f))); 
+				}; 
+
+				retainedText.verticies.clear(); 
+
+				// Glyphs are placed relative to the baseline of the first line. 
+				gs::Vec2f pen = gs::Vec2f(0.0f, style.characterSize); 
+				gs::Vec2f minPosition = gs::Vec2f(
+					style.characterSize, style.characterSize); 
+				gs::Vec2f maxPosition; 
+				sf::Uint32 prvsCharacter = 0; 
+
+				for (unsigned char character : retainedText.string) {
+					pen.x += font.getKerning(
+						prvsCharacter, character, style.characterSize); 
+					prvsCharacter = character; 
+
+					if (character == ' ' || character == '\t' || character == '\n') {
+						minPosition.x = std::min(minPosition.x, pen.x); 
+						minPosition.y = std::min(minPosition.y, pen.y); 
+
+						if (character == ' ')
+							pen.x += whitespaceWidth; 
+						else if (character == '\t')
+							pen.x += whitespaceWidth * 4.0f; 
+						else 
+							pen = gs::Vec2f(0.0f, pen.y + lineSpacing); 
+
+						maxPosition.x = std::max(maxPosition.x, pen.x); 
+						maxPosition.y = std::max(maxPosition.y, pen.y); 
+						continue; 
+					}
+
+					if (outlineThickness != 0.0f) {
+						addGlyphQuad(retainedText.verticies, pen, 
+							style.outlineColor, font.getGlyph(character, 
+								style.characterSize, false, outlineThickness)); 
+					}
+
+					const sf::Glyph& glyph = font.getGlyph(
+						character, style.characterSize, false); 
+
+					addGlyphQuad(fillVerticies, pen, style.fillColor, glyph); 
+
+					minPosition.x = std::min(minPosition.x, 
+						pen.x + glyph.bounds.left); 
+					minPosition.y = std::min(minPosition.y, 
+						pen.y + glyph.bounds.top); 
+					maxPosition.x = std::max(maxPosition.x, 
+						pen.x + glyph.bounds.left + glyph.bounds.width); 
+					maxPosition.y = std::max(maxPosition.y, 
+						pen.y + glyph.bounds.top + glyph.bounds.height); 
+
+					pen.x += glyph.advance; 
+				}
+
+				// Outlines are drawn underneath the fill. 
+				retainedText.verticies.insert(retainedText.verticies.end(), 
+					fillVerticies.begin(), fillVerticies.end()); 
+
+				if (retainedText.string.empty())
+					minPosition = maxPosition = gs::Vec2f(); 
+
+				retainedText.localBounds = sf::FloatRect(
+					minPosition.x - outlineThickness, 
+					minPosition.y - outlineThickness, 
+					maxPosition.x - minPosition.x + (outlineThickness * 2.0f), 
+					maxPosition.y - minPosition.y + (outlineThickness * 2.0f)
+				); 
+			}
+			const RetainedText& getRetainedText(
+				const std::string& string, const TextStyle& style) 
+			{
+				// Hashing the string doesn't allocate, unlike building a key. 
+				std::size_t key = std::hash<std::string>()(string); 
+
+				auto combine = [&key](std::size_t value) {
+					key ^= value + 0x9e3779b9 + (key << 6) + (key >> 2); 
+				}; 
+
+				combine(std::hash<const void*>()(style.font)); 
+				combine(style.characterSize); 
+				combine(std::hash<float>()(style.scale.x)); 
+				combine(std::hash<float>()(style.scale.y)); 
+				combine(style.fillColor.toInteger()); 
+				combine(std::hash<float>()(style.outlineThickness)); 
+				combine(style.outlineColor.toInteger()); 
+
+				// Drops texts which haven't been used recently. 
+				if (retainedTexts.size() > maxNumOfRetainedTexts) {
+					for (auto retainedText = retainedTexts.begin(); 
+						retainedText != retainedTexts.end();) 
+					{
+						if (retainedText->second.lastUsedTick < window::ticks - 1)
+							retainedText = retainedTexts.erase(retainedText); 
+						else
+							retainedText++; 
+					}
+				}
+
+				RetainedText& retainedText = retainedTexts[key]; 
+
+				// Also rebuilds when two strings share a hash. 
+				if (retainedText.string != string || !(retainedText.style == style)
+					|| retainedText.style.font == nullptr) 
+				{
+					retainedText.string = string; 
+					retainedText.style = style; 
+					layoutRetainedText(retainedText); 
+				}
+
+				retainedText.lastUsedTick = window::ticks; 
+
+				return retainedText; 
+			}
+			void renderRetainedText(
+				const std::string& string, gs::Vec2f position, bool centered, 
+				bool ignoreRendering) 
+			{
+				static sf::RectangleShape textBackground; 
+
+				const sf::Text& textStyle = text.getText(); 
+				const RetainedText& retainedText = getRetainedText(string, {
+					textStyle.getFont(), textStyle.getCharacterSize(), 
+					textStyle.getScale(), textStyle.getFillColor(), 
+					textStyle.getOutlineThickness(), textStyle.getOutlineColor()
+				}); 
+				const gs::Vec2f scale = retainedText.style.scale; 
+				const sf::FloatRect& localBounds = retainedText.localBounds; 
+				const gs::Vec2f size = gs::Vec2f(
+					localBounds.width * scale.x, localBounds.height * scale.y); 
+
+				// Moves text to position it fits perfectly with the requested
+				// position. 
+				gs::Vec2f origin = position - gs::Vec2f(
+					localBounds.left * scale.x, localBounds.top * scale.y); 
+
+				if (centered)
+					origin -= size * 0.5f; 
+
+				// Bounds at the rounded down position, matching renderText. 
+				sf::FloatRect textBounds = sf::FloatRect(
+					std::floor(position.x) + (localBounds.left * scale.x), 
+					std::floor(position.y) + (localBounds.top * scale.y), 
+					size.x, size.y
+				); 
+
+				if (ignoreRendering) {
+					prvsTextBounds = textBounds;
+					return;
+				}
+
+				if (textBackgroundColor != gs::Color::Transparent) {
+					textBounds = sf::FloatRect(
+						origin.x + (localBounds.left * scale.x), 
+						origin.y + (localBounds.top * scale.y), size.x, size.y
+					); 
+
+					textBackground.setSize(gs::Vec2f(
+						textBounds.width + (textBackgroundThickness * 2.0f),
+						textBounds.height + (textBackgroundThickness * 2.0f)
+					)); 
+					textBackground.setPosition(gs::Vec2f(
+						textBounds.left - textBackgroundThickness,
+						textBounds.top - textBackgroundThickness
+					)); 
+					textBackground.setFillColor(textBackgroundColor); 
+
+					window::winmain->draw(textBackground); 
+				}
+
+				if (!retainedText.verticies.empty()) {
+					sf::RenderStates states(&retainedText.style.font->getTexture(
+						retainedText.style.characterSize)); 
+
+					states.transform.translate(origin.x, origin.y); 
+					states.transform.scale(scale.x, scale.y); 
+
+					window::winmain->draw(retainedText.verticies.data(), 
+						retainedText.verticies.size(), sf::Quads, states); 
+				}
+
+				prvsTextBounds = textBounds; 
+			}
 			void renderText(const std::string& string, gs::Vec2f position,
 				bool centered, bool ignoreRendering)
 			{
 				static sf::RectangleShape textBackground; 
 
+				// Shadowed text is left to Glass, everything else is retained. 
+				if (!textShadow) {
+					renderRetainedText(string, position, centered, ignoreRendering); 
+					return; 
+				}
+
 				text.setString(string);
 				text.setPosition(
 					// Rounds down components to prevent excess blur. 
@@ -409,6 +635,7 @@ namespace engine {
 			int furnaceSlotSelected = -1;
 			bool furnaceOutputSelected = false;
 			int chestSlotSelected = -1;
+			RetainedSlotRegion retainedSlotRegions[RetainedSlotRegion::End]; 
 
 			void loadAssets() {
 				// Load in font files. 
@@ -934,9 +1161,8 @@ namespace engine {
 					settingsSoundVolumeButton.getPosition()
 				);
 				settingsVideoSettingsLightingStyleButton.setString(
-					"Lighting Style: " + std::string(render::lighting::lightingStyle ==
-						render::lighting::LightingStyle::Geometry
-							? "Geometry" : "Smooth")
+					"Lighting Style: " + render::lighting::lightingStyleNames[
+						static_cast<int>(render::lighting::lightingStyle)]
 				);
 
 				settingsVideoSettingsRenderBiomeBackgroundButton = settingsVideoSettingsButton; 
@@ -1324,6 +1550,20 @@ namespace engine {
 
 				target.draw(itemSprite);
 			}
+			const std::string& getItemCountString(int count) {
+				static std::vector<std::string> itemCountStrings; 
+
+				// Counts are formatted the first time they're shown. 
+				while (itemCountStrings.size() <= count) {
+					const int newCount = itemCountStrings.size(); 
+
+					// Adds space if item count is only 1 digit.
+					itemCountStrings.push_back(newCount < 10 
+						? " " + toString(newCount) : toString(newCount)); 
+				}
+
+				return itemCountStrings[count]; 
+			}
 			void renderInventoryItem(
 				const ItemContainer& itemContainer, gs::Vec2f position)
 			{
@@ -1340,11 +1580,8 @@ namespace engine {
 					// Only displays text if the number of items is 
 					// greater than 1.
 					if (itemContainer.count > 1) {
-						const std::string displayNumber =
-							// Adds space if item count is only 1 digit.
-							itemContainer.count < 10 ? " "
-							+ toString(itemContainer.count)
-							: toString(itemContainer.count);
+						const std::string& displayNumber = 
+							getItemCountString(itemContainer.count);
 						const gs::Vec2f textScale = gs::Vec2f(
 							guiScale, guiScale) * 0.3f;
 
@@ -1418,6 +1655,163 @@ namespace engine {
 					}
 				}
 			}
+			void beginRetainedSlots(RetainedSlotRegion::Id regionId, int numOfSlots) {
+				RetainedSlotRegion& region = retainedSlotRegions[regionId]; 
+
+				if (region.numOfSlots != numOfSlots || region.guiScale != guiScale) {
+					region.numOfSlots = numOfSlots; 
+					region.guiScale = guiScale; 
+					region.changed = true; 
+				}
+			}
+			void setRetainedSlot(
+				RetainedSlotRegion::Id regionId, int slotIndex, 
+				const ItemContainer& itemContainer, gs::Vec2f position)
+			{
+				RetainedSlotRegion& region = retainedSlotRegions[regionId]; 
+				ItemContainer& retainedItemContainer = 
+					region.itemContainers[slotIndex]; 
+
+				// Item containers are modified in place all over the game, so
+				// the previous copy is compared instead of tracking changes. 
+				if (retainedItemContainer.count != itemContainer.count
+					|| retainedItemContainer.item.id != itemContainer.item.id
+					|| retainedItemContainer.item.tags.asInt 
+						!= itemContainer.item.tags.asInt
+					|| region.positions[slotIndex] != position) 
+				{
+					retainedItemContainer = itemContainer; 
+					region.positions[slotIndex] = position; 
+					region.changed = true; 
+				}
+			}
+			void buildRetainedSlots(RetainedSlotRegion& region) {
+				const gs::Vec2f textScale = gs::Vec2f(guiScale, guiScale) * 0.3f; 
+
+				// Adds an untextured quad. 
+				auto addDurabilityQuad = [&region](
+					gs::Vec2f position, gs::Vec2f size, gs::Color color) 
+				{
+					region.durabilityVerticies.resize(
+						region.durabilityVerticies.size() + 4, 
+						sf::Vertex(gs::Vec2f(), color)
+					); 
+					applyVertexBounds(&region.durabilityVerticies[
+						region.durabilityVerticies.size() - 4], position, size); 
+				}; 
+				// Copies the glyph quads of a string into the region. 
+				auto addCountText = [&region, textScale](
+					const std::string& string, gs::Vec2f position, 
+					gs::Color color) 
+				{
+					const RetainedText& retainedText = getRetainedText(string, {
+						&fonts[0], text.getText().getCharacterSize(), 
+						textScale, color, 0.0f, gs::Color()
+					}); 
+					const sf::FloatRect& localBounds = retainedText.localBounds; 
+					const gs::Vec2f origin = position - gs::Vec2f(
+						localBounds.left * textScale.x, 
+						localBounds.top * textScale.y
+					); 
+
+					for (sf::Vertex vertex : retainedText.verticies) {
+						vertex.position = origin + gs::Vec2f(
+							vertex.position.x * textScale.x, 
+							vertex.position.y * textScale.y
+						); 
+						region.countVerticies.push_back(vertex); 
+					}
+				}; 
+
+				region.itemVerticies.clear(); 
+				region.durabilityVerticies.clear(); 
+				region.countVerticies.clear(); 
+
+				for (int slotIndex = 0; slotIndex < region.numOfSlots; slotIndex++) {
+					const ItemContainer& itemContainer = 
+						region.itemContainers[slotIndex]; 
+					gs::Vec2f position = region.positions[slotIndex]; 
+
+					if (itemContainer.count == 0)
+						continue; 
+
+					const int textureIndex = itemContainer.item.getVar(
+						ItemInfo::textureIndex); 
+					// Items from the item-atlas are rendered slightly bigger, 
+					// matching renderItem. 
+					const float itemSize = 10.0f * guiScale * (textureIndex 
+						< ItemInfo::defaultTileItems ? 1.4f : 1.0f); 
+
+					region.itemVerticies.resize(region.itemVerticies.size() + 4); 
+
+					sf::Vertex* quads = &region.itemVerticies[
+						region.itemVerticies.size() - 4]; 
+
+					applyVertexBounds(quads, position 
+						- gs::Vec2f(itemSize, itemSize) * 0.5f, 
+						gs::Vec2f(itemSize, itemSize)); 
+					applyTextureBounds(quads, getItemTextureBounds(
+						itemContainer.item)); 
+
+					const int itemMaxDurability = itemContainer.item.getVar(
+						ItemInfo::maxDurability
+					);
+
+					if (itemContainer.count > 1) {
+						const std::string& displayNumber = 
+							getItemCountString(itemContainer.count);
+
+						addCountText(displayNumber, position 
+							+ gs::Vec2f(-2.0f, 2.0f) * guiScale, gs::Color::Black); 
+						addCountText(displayNumber, position 
+							+ gs::Vec2f(-3.0f, 1.0f) * guiScale, gs::Color::White); 
+					}
+					else if (itemMaxDurability > 0) {
+						const float ratio = itemContainer.item.tags.durability
+							/ static_cast<float>(itemMaxDurability);
+
+						if (ratio < 1.0f) {
+							const float barWidth = 12.0f; 
+							const gs::Vec2f barPosition = 
+								position + gs::Vec2f(-6.0f, 5.0f) * guiScale; 
+							const gs::Color barColor = gs::util::approach(
+								gs::Color::Red, gs::Color::Green, ratio * 100.0f
+							); 
+
+							addDurabilityQuad(barPosition, gs::Vec2f(
+								barWidth + 1.0f, 2.0f) * guiScale, gs::Color::Black); 
+							addDurabilityQuad(barPosition, gs::Vec2f(
+								barWidth * ratio, 1.0f) * guiScale, barColor); 
+							addDurabilityQuad(barPosition + gs::Vec2f(
+								barWidth * ratio * guiScale, 0.0f), gs::Vec2f(
+									barWidth * (1.0f - ratio), 1.0f) * guiScale, 
+								gs::util::approach(barColor, gs::Color::Black, 80.0f)); 
+						}
+					}
+				}
+
+				region.changed = false; 
+			}
+			void renderRetainedSlots(RetainedSlotRegion::Id regionId) {
+				RetainedSlotRegion& region = retainedSlotRegions[regionId]; 
+
+				if (region.changed)
+					buildRetainedSlots(region); 
+
+				if (!region.itemVerticies.empty()) {
+					window::winmain->draw(region.itemVerticies.data(), 
+						region.itemVerticies.size(), sf::Quads, &entityAtlas); 
+				}
+				if (!region.durabilityVerticies.empty()) {
+					window::winmain->draw(region.durabilityVerticies.data(), 
+						region.durabilityVerticies.size(), sf::Quads); 
+				}
+				if (!region.countVerticies.empty()) {
+					window::winmain->draw(region.countVerticies.data(), 
+						region.countVerticies.size(), sf::Quads, 
+						&fonts[0].getTexture(text.getText().getCharacterSize())); 
+				}
+			}
 			void renderTextBox(const std::string& name, gs::Vec2f position) {
 				static sf::RectangleShape background, insideOutline; 
 
@@ -1471,7 +1865,8 @@ namespace engine {
 				window::winmain->draw(insideOutline); 
 
 				// Lastly render the text over top of the background box. 
-				gs::draw(window::winmain, text); 
+				renderText(name, position + gs::Vec2f(boarderThickness, 
+					boarderThickness)); 
 			}
 
 			void updateLoadingScreen() {
@@ -1879,14 +2274,10 @@ namespace engine {
 					else if (settingsVideoSettingsLightingStyleButton.isSelected
 						&& settingsVideoSettingsLightingStyleButton.isClickedOn)
 					{
-						lighting::lightingStyle = 
-							lighting::lightingStyle == lighting::LightingStyle::Geometry 
-								? lighting::LightingStyle::Smooth 
-								: lighting::LightingStyle::Geometry; 
+						lighting::cycleLightingStyle(); 
 						settingsVideoSettingsLightingStyleButton.setString(
-							"Lighting Style: " + std::string((lighting::lightingStyle ==
-								lighting::LightingStyle::Geometry)
-									? "Geometry" : "Smooth")
+							"Lighting Style: " + lighting::lightingStyleNames[
+								static_cast<int>(lighting::lightingStyle)]
 						); 
 						audio::playSoundEffect(audio::SoundEffect::ButtonClick); 
 					}
@@ -2035,7 +2426,7 @@ namespace engine {
 				if (window::ticks % 20 == 0 || fpsString.empty())
 					fpsString = toString(window::renderingFramerate) + "/"
 						+ toString(window::currentFramerate) + "/" 
-						+ toString(window::currentUncappedFramerate);	
+						+ toString(window::currentUncappedFramerate) + " fps";	
 			}
 			void updatePauseMenu() {
 				if (pausedSettingsOpen) {
@@ -2568,10 +2959,7 @@ namespace engine {
 					transition.state = -1; 
 				}
 				else if (input::isKeyClicked(input::ChangeLightingStyle))
-					lighting::lightingStyle = lighting::lightingStyle
-						== lighting::LightingStyle::Geometry
-							? lighting::LightingStyle::Smooth
-							: lighting::LightingStyle::Geometry;
+					lighting::cycleLightingStyle();
 				else if (input::isKeyClicked(input::EnableFullBright))
 					lighting::fullBrightEnabled = !lighting::fullBrightEnabled;
 				else if (input::isKeyClicked(input::ChangeFramerate))
@@ -2691,7 +3079,7 @@ namespace engine {
 
 				// Render text. 
 
-				text.setShadow(true);
+				setTextShadow(true);
 				text.setShadowOffset(0.0f, 4.0f);
 
 				renderText(
@@ -2735,7 +3123,7 @@ namespace engine {
 				gs::draw(window::winmain, titleYouTubeButton);
 				window::winmain->draw(titleYouTubeUnderline); 
 				 
-				text.setShadow(false);
+				setTextShadow(false);
 			}
 			void renderMenuBackground(bool multiLayer, int layer) {
 				auto generateBackgroundTextureBounds = [](float height)
@@ -2843,7 +3231,7 @@ namespace engine {
 			void renderWorldSelectionScreen() {
 				renderMenuBackground(true, 0); 
 
-				text.setShadow(true); 
+				setTextShadow(true); 
 				text.setShadowOffset(0.0f, 4.0f); 
 
 				for (int worldPreviewIndex = 0; worldPreviewIndex <
@@ -2881,12 +3269,12 @@ namespace engine {
 				renderMenuButton(worldSelectionCancelButton); 
 				gs::draw(window::winmain, worldSelectionSlider); 
 
-				text.setShadow(false); 
+				setTextShadow(false); 
 			}
 			void renderWorldEditScreen() {
 				renderMenuBackground(false);
 
-				text.setShadow(true);
+				setTextShadow(true);
 				text.setShadowOffset(0.0f, 4.0f);
 
 				renderText(
@@ -2916,12 +3304,12 @@ namespace engine {
 				renderMenuButton(worldEditSaveButton); 
 				renderMenuButton(worldEditCancelButton); 
 
-				text.setShadow(false);
+				setTextShadow(false);
 			}
 			void renderWorldCreateScreen() {
 				renderMenuBackground(false);
 
-				text.setShadow(true);
+				setTextShadow(true);
 				text.setShadowOffset(0.0f, 4.0f);
 
 				renderText(
@@ -2945,7 +3333,7 @@ namespace engine {
 				renderMenuButton(worldCreateNewWorldButton); 
 				renderMenuButton(worldCreateCancelButton); 
 
-				text.setShadow(false);
+				setTextShadow(false);
 			}
 			void renderChangeLogScreen() {
 				renderMenuBackground(true, 0);
@@ -3069,6 +3457,20 @@ namespace engine {
 					break; 
 				}
 			}
+			template<typename FormatString>
+			const std::string& getCachedString(
+				CachedString& cachedString, std::initializer_list<double> values, 
+				FormatString formatString)
+			{
+				if (!std::equal(values.begin(), values.end(), 
+					cachedString.values.begin(), cachedString.values.end()))
+				{
+					cachedString.values.assign(values); 
+					cachedString.string = formatString(); 
+				}
+
+				return cachedString.string; 
+			}
 			void renderDebugMenu() {
 				auto truncateFloat = [](float value, int decimalPlaces = 2)
 					-> std::string 
@@ -3105,63 +3507,133 @@ namespace engine {
 				); 
 				renderText(window::gameTitle, gs::Vec2f(15.0f, 15.0f));
 				renderText(
-					fpsString + " fps", gs::Vec2f(15.0f, prvsTextBounds.top 
+					fpsString, gs::Vec2f(15.0f, prvsTextBounds.top 
 						+ prvsTextBounds.height + (2.0f * backgroundThickness))
 				);
 				printSpace(); 
 
-				renderText(
-					toString(tilesRendered) + " tiles rendered",
-					gs::Vec2f(15.0f, prvsTextBounds.top
-						+ prvsTextBounds.height + (2.0f * backgroundThickness))
-				);
-				renderText(
-					toString(lighting::lightsRendered) + " lights rendered", 
-					gs::Vec2f(15.0f, prvsTextBounds.top
-						+ prvsTextBounds.height + (2.0f * backgroundThickness))
-				); 
-				renderText(
-					"Blocks updated: " + toString(world->getNumOfBlocksUpdated()),
-					gs::Vec2f(15.0f, prvsTextBounds.top
-						+ prvsTextBounds.height + (2.0f * backgroundThickness))
-				);
-				renderText(
-					"Light update rate: " + toString(lighting::lightUpdateRate),
-					gs::Vec2f(15.0f, prvsTextBounds.top
-						+ prvsTextBounds.height + (2.0f * backgroundThickness))
-				);
-				renderText(
-					"Entities loaded: " + toString(Entity::numOfEntities) + "/h"
+				// Grows with the number of lines, so lines can be added freely. 
+				static std::vector<CachedString> debugStrings; 
+				int debugLineIndex = 0; 
+
+				// Renders the next line, only formatting it again when the 
+				// values shown have changed. 
+				auto renderDebugLine = [&](
+					std::initializer_list<double> values, auto formatString) 
+				{
+					if (debugLineIndex == debugStrings.size())
+						debugStrings.emplace_back(); 
+
+					renderText(
+						getCachedString(debugStrings[debugLineIndex++], values,
+							formatString), 
+						gs::Vec2f(15.0f, prvsTextBounds.top 
+							+ prvsTextBounds.height + (2.0f * backgroundThickness))
+					);
+				};
+
+				renderDebugLine({ static_cast<double>(tilesRendered) }, [&]() {
+					return toString(tilesRendered) + " tiles rendered"; 
+				});
+				renderDebugLine({ static_cast<double>(tilesRebuilt) }, [&]() {
+					return toString(tilesRebuilt) + " tiles rebuilt"; 
+				});
+				renderDebugLine({ static_cast<double>(drawCalls) }, [&]() {
+					return toString(drawCalls) + " draw calls"; 
+				});
+
+				const int peakVerticies = tileVertexArena.getPeakSize()
+					+ tileOverlayVertexArena.getPeakSize()
+					+ lightMapVertexArena.getPeakSize(); 
+				const int numOfReallocations = 
+					tileVertexArena.getNumOfReallocations()
+					+ tileOverlayVertexArena.getNumOfReallocations()
+					+ lightMapVertexArena.getNumOfReallocations(); 
+
+				renderDebugLine({ static_cast<double>(peakVerticies), 
+					static_cast<double>(numOfReallocations) }, [&]() 
+				{
+					return "Peak verticies: " + toString(peakVerticies) + "/" 
+						+ toString(numOfReallocations) + " reallocations"; 
+				});
+				renderDebugLine({ static_cast<double>(lighting::lightsRendered) }, 
+					[&]() 
+				{
+					return toString(lighting::lightsRendered) + " lights rendered"; 
+				});
+				renderDebugLine({ static_cast<double>(
+					lighting::dynamicLights.size()), static_cast<double>(
+						lighting::dynamicLightUpdates) }, [&]() 
+				{
+					return toString(lighting::dynamicLights.size()) 
+						+ " dynamic lights/" 
+						+ toString(lighting::dynamicLightUpdates) + " moved"; 
+				});
+				renderDebugLine({ static_cast<double>(lighting::dirtyLightArea) }, 
+					[&]() 
+				{
+					return "Dirty light area: " 
+						+ toString(lighting::dirtyLightArea) + " tiles"; 
+				});
+
+				const int numOfBlocksUpdated = world->getNumOfBlocksUpdated(); 
+
+				renderDebugLine({ static_cast<double>(numOfBlocksUpdated) }, [&]() {
+					return "Blocks updated: " + toString(numOfBlocksUpdated); 
+				});
+				renderDebugLine({ static_cast<double>(lighting::lightUpdateRate) }, 
+					[&]() 
+				{
+					return "Light update rate: " 
+						+ toString(lighting::lightUpdateRate); 
+				});
+
+				const int numOfEntities = getNumOfEntities(); 
+
+				renderDebugLine({ static_cast<double>(numOfEntities), 
+					static_cast<double>(Mob::numOfHostileMobs), 
+					static_cast<double>(Mob::numOfPassiveMobs) }, [&]() 
+				{
+					return "Entities loaded: " + toString(numOfEntities) + "/h"
 						+ toString(Mob::numOfHostileMobs) + "/p"
-						+ toString(Mob::numOfPassiveMobs),
-					gs::Vec2f(15.0f, prvsTextBounds.top
-						+ prvsTextBounds.height + (2.0f * backgroundThickness))
-				);
+						+ toString(Mob::numOfPassiveMobs); 
+				});
+
+				auto getTierCount = [](UpdateTier updateTier) {
+					return entityUpdateTierCounts[static_cast<int>(updateTier)]; 
+				};
+
+				renderDebugLine({ static_cast<double>(getTierCount(UpdateTier::Full)), 
+					static_cast<double>(getTierCount(UpdateTier::Reduced)), 
+					static_cast<double>(getTierCount(UpdateTier::Frozen)), 
+					static_cast<double>(getTierCount(UpdateTier::Sleeping)) }, 
+					[&]() 
+				{
+					return "Entity updates: " 
+						+ toString(getTierCount(UpdateTier::Full)) + "/r"
+						+ toString(getTierCount(UpdateTier::Reduced)) + "/f"
+						+ toString(getTierCount(UpdateTier::Frozen)) + "/s"
+						+ toString(getTierCount(UpdateTier::Sleeping)); 
+				});
 				printSpace(); 
 
-				renderText(
-					"XY: " + truncateFloat(player->position.x) + "/" 
-						+ truncateFloat(player->position.y),
-					gs::Vec2f(15.0f, prvsTextBounds.top + prvsTextBounds.height 
-						+ (2.0f * backgroundThickness))
-				);
-				renderText(
-					"Biome: " + Biome::biomeStrings[currentBiome],
-					gs::Vec2f(15.0f, prvsTextBounds.top
-						+ prvsTextBounds.height + (2.0f * backgroundThickness))
-				);
+				renderDebugLine({ player->position.x, player->position.y }, [&]() {
+					return "XY: " + truncateFloat(player->position.x) + "/" 
+						+ truncateFloat(player->position.y); 
+				});
+				renderDebugLine({ static_cast<double>(currentBiome) }, [&]() {
+					return "Biome: " + Biome::biomeStrings[currentBiome]; 
+				});
 				printSpace(); 
 
-				renderText(
-					"Seed: " + toString(world->seed),
-					gs::Vec2f(15.0f, prvsTextBounds.top
-						+ prvsTextBounds.height + (2.0f * backgroundThickness))
-				);
-				renderText(
-					"Game Time: " + toString(world->gameTime.gameTicks),
-					gs::Vec2f(15.0f, prvsTextBounds.top
-						+ prvsTextBounds.height + (2.0f * backgroundThickness))
-				);
+				renderDebugLine({ static_cast<double>(world->seed) }, [&]() {
+					return "Seed: " + toString(world->seed); 
+				});
+				renderDebugLine({ static_cast<double>(world->gameTime.gameTicks) }, 
+					[&]() 
+				{
+					return "Game Time: " + toString(world->gameTime.gameTicks); 
+				});
 			}
 			void renderPauseMenu() {
 				if (pausedSettingsOpen) {
@@ -3169,7 +3641,7 @@ namespace engine {
 					return; 
 				}
 
-				text.setShadow(true);
+				setTextShadow(true);
 				text.setShadowOffset(0.0f, 4.0f);
 
 				renderText(
@@ -3184,10 +3656,10 @@ namespace engine {
 				renderMenuButton(pauseSettingsButton); 
 				renderMenuButton(pauseSaveAndQuitButton); 
 
-				text.setShadow(false); 
+				setTextShadow(false); 
 			}
 			void renderGameOverMenu() {
-				text.setShadow(true);
+				setTextShadow(true);
 				text.setShadowOffset(8.0f, 8.0f);
 
 				renderText(
@@ -3201,7 +3673,7 @@ namespace engine {
 				renderMenuButton(gameOverRespawnButton); 
 				renderMenuButton(gameOverTitleMenuButton); 
 
-				text.setShadow(false);
+				setTextShadow(false);
 			}
 			void renderCrosshair() {
 				if (!shouldCrosshairBeRendered)
@@ -3300,19 +3772,24 @@ namespace engine {
 						hotbarSprite.getPosition().y
 					);
 
+					beginRetainedSlots(RetainedSlotRegion::Hotbar, 
+						Player::numOfHotbarSlots); 
+
 					for (int hotbarSlot = 0; hotbarSlot < 
 						Player::numOfHotbarSlots; hotbarSlot++) 
 					{
 						const ItemContainer& itemContainer = 
 							player->inventory[hotbarSlot];
 
-						renderInventoryItem(
-							itemContainer, 
+						setRetainedSlot(
+							RetainedSlotRegion::Hotbar, hotbarSlot, itemContainer, 
 							gs::Vec2f(hotbarStartXpos + (hotbarSlot * hotbarGapWidth),
 								hotbarSprite.getPosition().y
 						)); 
 					}
 
+					renderRetainedSlots(RetainedSlotRegion::Hotbar); 
+
 					window::winmain->draw(hotbarSelectorSprite);
 
 					// Xp-bar 
@@ -3482,7 +3959,6 @@ namespace engine {
 							const float eyeline = 26.0f;
 
 							Player previewPlayer = *player; 
-							Player::numOfEntities += 2; 
 
 							cameraScale = guiScale * 1.5f;
 
@@ -3561,16 +4037,21 @@ namespace engine {
 
 						switch (inventoryMenu) {
 						case InventoryMenu::Inventory:
+							beginRetainedSlots(RetainedSlotRegion::CraftingGrid, 4); 
+
 							for (int craftingSlotIndex = 0; craftingSlotIndex < 4;
 								craftingSlotIndex++)
 							{
 								const ItemContainer& itemContainer =
 									craftingItemGrid[craftingSlotIndex];
 
-								renderInventoryItem(itemContainer,
+								setRetainedSlot(RetainedSlotRegion::CraftingGrid, 
+									craftingSlotIndex, itemContainer,
 									getCraftingSlotPosition(craftingSlotIndex, false));
 							}
 
+							renderRetainedSlots(RetainedSlotRegion::CraftingGrid); 
+
 							prepareText(
 								0, gs::Vec2f(guiScale, guiScale) * 0.33f,
 								gs::Color(60, 60, 65)
@@ -3583,16 +4064,21 @@ namespace engine {
 
 							break; 
 						case InventoryMenu::Crafting:
+							beginRetainedSlots(RetainedSlotRegion::CraftingGrid, 9); 
+
 							for (int craftingSlotIndex = 0; craftingSlotIndex < 9;
 								craftingSlotIndex++)
 							{
 								const ItemContainer& itemContainer =
 									craftingItemGrid[craftingSlotIndex];
 
-								renderInventoryItem(itemContainer,
+								setRetainedSlot(RetainedSlotRegion::CraftingGrid, 
+									craftingSlotIndex, itemContainer,
 									getCraftingSlotPosition(craftingSlotIndex, true));
 							}
 
+							renderRetainedSlots(RetainedSlotRegion::CraftingGrid); 
+
 							prepareText(
 								0, gs::Vec2f(guiScale, guiScale) * 0.33f,
 								gs::Color(60, 60, 65)
@@ -3614,19 +4100,23 @@ namespace engine {
 								world->getTileEntity(tileEntityPosition); 
 
 							if (tileEntity != nullptr) {
+								beginRetainedSlots(RetainedSlotRegion::Container, 3); 
+
 								for (int furnaceSlot = 0; furnaceSlot < 2; furnaceSlot++) {
 									const ItemContainer& itemContainer = 
 										tileEntity->getItemContainer(furnaceSlot); 
 
-									renderInventoryItem(itemContainer, 
+									setRetainedSlot(RetainedSlotRegion::Container, 
+										furnaceSlot, itemContainer, 
 										getFurnaceInputPosition(furnaceSlot));
 								}
 
 								const ItemContainer& itemContainer =
 									tileEntity->getItemContainer(2);
 
-								renderInventoryItem(itemContainer,
-									getFurnaceOutputPosition());
+								setRetainedSlot(RetainedSlotRegion::Container, 2, 
+									itemContainer, getFurnaceOutputPosition());
+								renderRetainedSlots(RetainedSlotRegion::Container); 
 
 								const float fuelProgressScaler = static_cast<float>(
 									tileEntity->tags.fuelRemaining)
@@ -3687,15 +4177,21 @@ namespace engine {
 								world->getTileEntity(tileEntityPosition); 
 
 							if (tileEntity != nullptr) {
+								beginRetainedSlots(RetainedSlotRegion::Container, 
+									TileEntity::numOfChestSlots); 
+
 								for (int chestSlot = 0; chestSlot <
 									TileEntity::numOfChestSlots; chestSlot++)
 								{
 									const ItemContainer& itemContainer =
 										tileEntity->getItemContainer(chestSlot); 
 
-									renderInventoryItem(itemContainer,
+									setRetainedSlot(RetainedSlotRegion::Container, 
+										chestSlot, itemContainer,
 										getChestSlotPosition(chestSlot)); 
 								}
+
+								renderRetainedSlots(RetainedSlotRegion::Container); 
 							}
 
 							prepareText(
@@ -3716,16 +4212,22 @@ namespace engine {
 						}
 
 						// Render inventory items. 
+						beginRetainedSlots(RetainedSlotRegion::Inventory, 
+							Player::numOfInventorySlots); 
+
 						for (int inventoryIndex = 0; inventoryIndex <
 							Player::numOfInventorySlots; inventoryIndex++)
 						{
 							const ItemContainer& itemContainer =
 								player->inventory[inventoryIndex];  
 
-							renderInventoryItem(itemContainer, 
+							setRetainedSlot(RetainedSlotRegion::Inventory, 
+								inventoryIndex, itemContainer, 
 								getInventorySlotPosition(inventoryIndex));
 						}
 
+						renderRetainedSlots(RetainedSlotRegion::Inventory); 
+
 						// Render recipe output if output exists. 
 						if (outputRecipeContainer.count > 0) {
 							const ItemContainer itemContainer(
@@ -3733,8 +4235,10 @@ namespace engine {
 								outputRecipeContainer.recipe.count
 							); 
 
-							renderInventoryItem(itemContainer, 
-								getCraftingOutputSlotPosition(fullTable));
+							beginRetainedSlots(RetainedSlotRegion::CraftingOutput, 1); 
+							setRetainedSlot(RetainedSlotRegion::CraftingOutput, 0, 
+								itemContainer, getCraftingOutputSlotPosition(fullTable));
+							renderRetainedSlots(RetainedSlotRegion::CraftingOutput); 
 						}
 
 						// Renders item at mouse position, if one is held. 
@@ -0,0 +1,77 @@
+#include "../../hdr/graphics/VertexArena.hpp"
+
+namespace engine {
+	namespace render {
+		VertexArena::VertexArena(int initialCapacity) :
+			verticies(initialCapacity), 
+			size(0), 
+			peakSize(0), 
+			numOfReallocations(0), 
+			vertexBuffer(sf::Quads, sf::VertexBuffer::Stream)
+		{
+		}
+
+		void VertexArena::clear() {
+			size = 0; 
+		}
+		sf::Vertex* VertexArena::allocate(int numOfVerticies) {
+			const int requiredSize = size + numOfVerticies; 
+
+			if (requiredSize > static_cast<int>(verticies.size())) {
+				// Doubles in size to keep reallocations rare. 
+				verticies.resize(std::max(requiredSize, 
+					static_cast<int>(verticies.size()) * 2)); 
+				numOfReallocations++; 
+			}
+
+			sf::Vertex* allocation = verticies.data() + size; 
+
+			size = requiredSize; 
+			peakSize = std::max(peakSize, size); 
+
+			return allocation; 
+		}
+		void VertexArena::deallocate(int numOfVerticies) {
+			size = std::max(size - numOfVerticies, 0); 
+		}
+		VertexArena::Batch VertexArena::beginBatch() const {
+			return { size, 0 }; 
+		}
+		void VertexArena::endBatch(Batch& batch) const {
+			batch.count = size - batch.start; 
+		}
+		void VertexArena::draw(
+			sf::RenderTarget& target, Batch batch, const sf::RenderStates& states)
+		{
+			if (batch.count == 0)
+				return; 
+
+			if (useVertexBuffers && sf::VertexBuffer::isAvailable()) {
+				// Matches the buffer to the capacity of the arena. 
+				if (vertexBuffer.getVertexCount() != verticies.size())
+					vertexBuffer.create(verticies.size()); 
+
+				vertexBuffer.update(&verticies[batch.start], batch.count, 
+					batch.start); 
+				target.draw(vertexBuffer, batch.start, batch.count, states); 
+			}
+			else
+				target.draw(&verticies[batch.start], batch.count, sf::Quads, states);
+		}
+
+		int VertexArena::getSize() const {
+			return size; 
+		}
+		int VertexArena::getCapacity() const {
+			return verticies.size(); 
+		}
+		int VertexArena::getPeakSize() const {
+			return peakSize; 
+		}
+		int VertexArena::getNumOfReallocations() const {
+			return numOfReallocations; 
+		}
+
+		bool VertexArena::useVertexBuffers = false; 
+	}
+}
\ No newline at end of file
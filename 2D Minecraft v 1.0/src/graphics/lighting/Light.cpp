@@ -6,23 +6,104 @@ namespace engine {
 		namespace lighting {
 			Light::Light() :
 				id(None),
+				entityBinding(EntityBinding::None), 
 				baseColor(TileColor::White),
 				strength(10),
 				centerRadius(0),
 				flicker(false),
 				flickerFrequency(1.0f),
 				flickerAmplitude(1.0f), 
-				flickerMaintainCenter(false)
+				flickerMaintainCenter(false), 
+				bindingItemId(0)
 			{
 			}
 
 			TileColor Light::getColor(gs::Vec2i position) const {
-				auto getLightPercentage = [&](float value) -> float {
-					const float amplitude = 5.0f * flickerAmplitude; 
-					return (amplitude * (std::sin(value) 
-						+ std::cos(3.0f * value) + 0.9f)) + amplitude;
-				}; 
+				TileColor color = getUnflickeredColor(); 
+				
+				if (flicker) {
+					const float value = (static_cast<float>(
+						window::ticks / 50.0f) * flickerFrequency) 
+							+ position.x + (3.0f * position.y); 
 
+					gs::util::approach(&color, TileColor::Black,
+						getFlickerPercentage(value)); 
+				}
+
+				return color; 
+			}
+			int Light::getFlickerPhase(gs::Vec2i position) const {
+				if (!flicker)
+					return 0; 
+
+				const float fullCycle = 2.0f * gs::util::PI; 
+				const float value = (static_cast<float>(
+					window::ticks / 50.0f) * flickerFrequency) 
+						+ position.x + (3.0f * position.y); 
+				const float cycle = value / fullCycle; 
+
+				return std::min(static_cast<int>((cycle - std::floor(cycle))
+					* numOfFlickerPhases), numOfFlickerPhases - 1); 
+			}
+			int Light::getFalloffSize(bool smooth) const {
+				return strength + centerRadius + static_cast<int>(smooth); 
+			}
+			const TileColor* Light::getFalloff(bool smooth, int flickerPhase) const {
+				return &falloffTables[static_cast<int>(smooth)][
+					flickerPhase * getFalloffSize(smooth)]; 
+			}
+			void Light::bakeFalloff() {
+				const TileColor color = getUnflickeredColor(); 
+				const int numOfPhases = flicker ? numOfFlickerPhases : 1; 
+
+				for (int style = 0; style < numOfFalloffStyles; style++) {
+					const bool smooth = style == 1; 
+					const int size = getFalloffSize(smooth); 
+					const int falloffCenterRadius = 
+						centerRadius + static_cast<int>(smooth); 
+					std::vector<TileColor>& falloff = falloffTables[style]; 
+
+					falloff.resize(numOfPhases * size); 
+
+					for (int phase = 0; phase < numOfPhases; phase++) {
+						TileColor phaseColor = color; 
+
+						// Samples the middle of each phase. 
+						if (flicker) {
+							gs::util::approach(&phaseColor, TileColor::Black,
+								getFlickerPercentage((phase + 0.5f) 
+									/ numOfFlickerPhases * 2.0f * gs::util::PI)); 
+						}
+
+						for (int distance = 0; distance < size; distance++) {
+							// Brightness ratio of tile, based on it's distance. 
+							float ratio = std::max(distance - falloffCenterRadius,
+								0) / static_cast<float>(strength - 1);
+
+							if (smooth)
+								ratio = std::sqrt(ratio); 
+
+							falloff[(phase * size) + distance] = gs::util::approach(
+								phaseColor, ambientLightColor, 
+								std::min(ratio * 100.0f, 100.0f)
+							); 
+						}
+					}
+				}
+
+				bakedColor = color; 
+			}
+			bool Light::isFalloffStale() const {
+				return getUnflickeredColor() != bakedColor; 
+			}
+
+			float Light::getFlickerPercentage(float value) const {
+				const float amplitude = 5.0f * flickerAmplitude; 
+
+				return (amplitude * (std::sin(value) 
+					+ std::cos(3.0f * value) + 0.9f)) + amplitude;
+			}
+			TileColor Light::getUnflickeredColor() const {
 				TileColor color = baseColor; 
 
 				if (id == Light::Sunlight) {
@@ -30,21 +111,28 @@ namespace engine {
 					gs::util::approach(&color, moonlightColor, 
 						sunlightBrightness);
 				}
-				
-				if (flicker) {
-					const float value = (static_cast<float>(
-						window::ticks / 50.0f) * flickerFrequency) 
-							+ position.x + (3.0f * position.y); 
 
-					gs::util::approach(&color, TileColor::Black,
-						getLightPercentage(value)); 
+				return color; 
+			}
+
+			Light::Id Light::getEntityLight(
+				EntityBinding entityBinding, int itemId) 
+			{
+				for (const Id lightId : entityLights) {
+					const Light& lightSource = lightSources[lightId]; 
+
+					if (lightSource.entityBinding == entityBinding
+						&& (entityBinding != EntityBinding::Item
+							|| lightSource.bindingItemId == itemId))
+						return lightId; 
 				}
 
-				return color; 
+				return None; 
 			}
 
 			Light Light::lightSources[Light::numOfLights];
 			int Light::maxLightRadius = 0; 
+			std::vector<Light::Id> Light::entityLights; 
 
 			void loadLights() {
 				const PairVector& pairs = loadPairedFile(
@@ -87,8 +175,26 @@ namespace engine {
 						else if (attribute == "flickerMaintainCenter")
 							lightSource->flickerMaintainCenter = 
 								static_cast<bool>(std::stoi(value)); 
+						else if (attribute == "entityBinding") {
+							lightSource->entityBinding = 
+								static_cast<Light::EntityBinding>(std::stoi(value));
+							Light::entityLights.push_back(lightId); 
+						}
+						else if (attribute == "bindingItem")
+							lightSource->bindingItemId = std::stoi(value); 
 					} 
 				}
+
+				// Includes the last light loaded. 
+				if (lightSource != nullptr) {
+					Light::maxLightRadius = std::max(
+						Light::maxLightRadius, lightSource->strength
+							+ lightSource->centerRadius
+					);
+				}
+
+				for (auto& light : Light::lightSources)
+					light.bakeFalloff(); 
 			}
 		}
 	}
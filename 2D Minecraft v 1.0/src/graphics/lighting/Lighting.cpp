@@ -5,8 +5,13 @@ namespace engine {
 	namespace render {
 		namespace lighting {
 			int lightUpdateRate = 10;
-			bool forceLights = false;
+			std::vector<sf::IntRect> dirtyLightRegions; 
+			int dirtyLightArea = 0; 
 			std::vector<std::pair<Light::Id, gs::Vec2i>> lights;
+			const std::string lightingStyleNames[
+				static_cast<int>(LightingStyle::End)] = {
+				"Geometry", "Smooth", "Texture"
+			}; 
 			TileColor ambientLightColor = TileColor(8, 9, 12);
 			TileColor sunlightColor;
 			TileColor moonlightColor = TileColor(50, 60, 80);
@@ -17,6 +22,13 @@ namespace engine {
 			int ticksUntilNextLightingUpdate = 0;
 			int ticksUntilNextSpawningLightingUpdate = 
 				timeBetweenSpawnLightingUpdates;
+			std::vector<TileColor> spawningLightColors; 
+			gs::Vec2i spawningLightOrigin; 
+			gs::Vec2i spawningLightSize; 
+			std::vector<DynamicLight> dynamicLights; 
+			std::unordered_map<gs::Vec2i, TileColor, HashContainer> 
+				staticTileColors; 
+			int dynamicLightUpdates = 0; 
 
 			bool isValidLight(gs::Vec2i position, Light::Id lightId) {
 				// Translations of all cardinal neighbors. 
@@ -39,6 +51,12 @@ namespace engine {
 
 				return false;
 			}
+			void cycleLightingStyle() {
+				lightingStyle = static_cast<LightingStyle>(
+					(static_cast<int>(lightingStyle) + 1) 
+						% static_cast<int>(LightingStyle::End)
+				); 
+			}
 			TileColor maximizeColors(TileColor color0, TileColor color1) {
 				return TileColor(
 					std::max(color0.r, color1.r),
@@ -50,71 +68,134 @@ namespace engine {
 				return color0.r > color1.r && color0.g > color1.g 
 					&& color0.b > color1.b;
 			}
-			void applyLight(const Light& lightSource, gs::Vec2i position, World& world) {
-				// Calculates distance as the sum of the absolute difference of 
-				// it's components. Creates a diamond distrabution. 
-				auto manhattan = [](gs::Vec2i start, gs::Vec2i end) -> int {
-					return std::abs(start.x - end.x) 
-						+ std::abs(start.y - end.y); 
+			Light::Id getBlockLightId(Block block) {
+				return static_cast<Light::Id>(
+					block.getVar(BlockInfo::applyAnimationLighting)
+					? Block(static_cast<Block::Id>(block.id
+						+ block.tags.animationOffset)).getVar(
+							BlockInfo::lightIndex)
+							: block.getVar(BlockInfo::lightIndex)
+				);
+			}
+			Light::Id getTileLightId(gs::Vec2i position) {
+				const Wall wall = world->getWall(position);
+				const Light::Id lightId = getBlockLightId(
+					world->getBlock(position)); 
+
+				// Sunlight is blocked by walls. 
+				if (lightId != Light::None && (wall.isEmpty()
+					|| lightId != Light::Sunlight))
+					return lightId; 
+
+				return Light::None; 
+			}
+			void markLightingDirty(sf::IntRect region) {
+				auto combineRegions = [](const sf::IntRect& region0, 
+					const sf::IntRect& region1) -> sf::IntRect 
+				{
+					const int left = std::min(region0.left, region1.left); 
+					const int top = std::min(region0.top, region1.top); 
+
+					return sf::IntRect(left, top, 
+						std::max(region0.left + region0.width, 
+							region1.left + region1.width) - left, 
+						std::max(region0.top + region0.height, 
+							region1.top + region1.height) - top
+					); 
 				}; 
 
-				const int centerRadius = lightingStyle == LightingStyle::Geometry
-					? lightSource.centerRadius : lightSource.centerRadius + 1; 
-				const int size = lightSource.strength + centerRadius; 
+				bool regionsCombined = true; 
+
+				// Merges overlapping regions so no tile is relit twice. 
+				while (regionsCombined) {
+					regionsCombined = false; 
+
+					for (auto dirtyRegion = dirtyLightRegions.begin(); 
+						dirtyRegion != dirtyLightRegions.end(); dirtyRegion++)
+					{
+						if (dirtyRegion->intersects(region)) {
+							region = combineRegions(*dirtyRegion, region); 
+							dirtyLightRegions.erase(dirtyRegion); 
+							regionsCombined = true; 
+							break; 
+						}
+					}
+				}
+
+				dirtyLightRegions.push_back(region); 
+
+				// Collapses everything into one region if there are too many.
+				if (dirtyLightRegions.size() > maxDirtyLightRegions) {
+					for (auto& dirtyRegion : dirtyLightRegions)
+						region = combineRegions(dirtyRegion, region); 
+
+					dirtyLightRegions.clear(); 
+					dirtyLightRegions.push_back(region); 
+				}
+			}
+			void markLightingDirty(gs::Vec2i position) {
+				// Any tile within reach of a light at the position could 
+				// change. 
+				const int margin = Light::maxLightRadius; 
+
+				markLightingDirty(sf::IntRect(
+					position.x - margin, position.y - margin, 
+					(2 * margin) + 1, (2 * margin) + 1
+				)); 
+			}
+			// Calls function with each tile a light source reaches, along with
+			// the color it gives that tile. 
+			template<typename Function>
+			void forEachLitTile(
+				const Light& lightSource, gs::Vec2i position, Function function)
+			{
+				const bool smooth = lightingStyle == LightingStyle::Smooth; 
+				const int size = lightSource.getFalloffSize(smooth); 
 				const gs::Vec2i startPosition = position - gs::Vec2i(size - 2, 0);
-				const TileColor lightColor = lightSource.getColor(position); 
+				// Colors for each distance, baked when the lights were loaded. 
+				const TileColor* falloff = lightSource.getFalloff(
+					smooth, lightSource.getFlickerPhase(position)); 
 
 				// Vertical distance away from the center. 
 				int yDelta = 0; 
 
 				for (int xpos = startPosition.x; xpos < position.x + size; xpos++) {
+					// Calculates distance as the sum of the absolute difference
+					// of it's components. Creates a diamond distrabution. 
+					const int xDistance = std::abs(xpos - position.x); 
+
 					for (int ypos = startPosition.y - yDelta; ypos <
 						startPosition.y + yDelta + 1; ypos++)
 					{
-						// Distance between current tile and the center of the light.
-						const float distance = manhattan({ xpos, ypos }, position);
-
-						// Brightness ratio of tile, based on it's distance. 
-						float ratio = std::max(distance - centerRadius, 0.0f) 
-							/ static_cast<float>(lightSource.strength - 1);
-
-						if (lightingStyle == LightingStyle::Smooth)
-							ratio = std::sqrt(ratio);
-						
-						const TileColor tileColor = gs::util::approach(
-							xpos == position.x && ypos == position.y 
-								&& lightSource.flickerMaintainCenter 
-									? lightSource.baseColor : lightColor, 
-							ambientLightColor, 
-							std::min(ratio * 100.0f, 100.0f)
-						);
-						const TileColor baseColor = world.getTileColor(xpos, ypos); 
+						const int distance = xDistance + std::abs(ypos - position.y); 
 
-						world.setTileColor(xpos, ypos, maximizeColors(baseColor, tileColor));
+						function(gs::Vec2i(xpos, ypos), distance == 0 
+							&& lightSource.flickerMaintainCenter 
+								? lightSource.baseColor : falloff[distance]); 
 					}
 
 					// Creates the diamond shape. 
 					yDelta += xpos < position.x ? 1 : -1; 
 				}
+			}
+			void applyLight(const Light& lightSource, gs::Vec2i position, World& world) {
+				forEachLitTile(lightSource, position, 
+					[&](gs::Vec2i tilePosition, TileColor tileColor) {
+						const TileColor baseColor = world.getTileColor(tilePosition); 
+
+						world.setTileColor(tilePosition, 
+							maximizeColors(baseColor, tileColor));
+					}
+				); 
 
 				lightsRendered++; 
 			}
 			void attemptLight(gs::Vec2i	position) {
-				const Block block = world->getBlock(position);
-				const Wall wall = world->getWall(position);
-				const Light::Id lightId = static_cast<Light::Id>(
-					block.getVar(BlockInfo::applyAnimationLighting)
-					? Block(static_cast<Block::Id>(block.id
-						+ block.tags.animationOffset)).getVar(
-							BlockInfo::lightIndex)
-							: block.getVar(BlockInfo::lightIndex)
-				);
+				const Light::Id lightId = getTileLightId(position); 
 
 				TileColor tileColor = ambientLightColor;
 
-				if (lightId != Light::None && (wall.isEmpty()
-					|| lightId != Light::Sunlight))
-				{
+				if (lightId != Light::None) {
 					const Light& lightSource =
 						Light::lightSources[lightId];
 
@@ -132,6 +213,254 @@ namespace engine {
 
 				world->setTileColor(position, tileColor);
 			}
+			void relightRegion(const sf::IntRect& region, World& world) {
+				const int margin = Light::maxLightRadius; 
+				std::vector<std::pair<Light::Id, gs::Vec2i>> regionLights; 
+
+				// Resets the tiles inside the region, and finds every light 
+				// which can reach it. 
+				for (int xpos = region.left - margin; xpos < region.left 
+					+ region.width + margin; xpos++) 
+				{
+					for (int ypos = std::max(region.top - margin, 0); ypos < 
+						std::min(region.top + region.height + margin, 
+							Chunk::height); ypos++) 
+					{
+						const bool insideRegion = region.contains(xpos, ypos); 
+						const Light::Id lightId = getTileLightId({ xpos, ypos }); 
+						TileColor tileColor = ambientLightColor; 
+
+						if (lightId != Light::None) {
+							if (isValidLight({ xpos, ypos }, lightId)) 
+								regionLights.push_back(
+									std::pair<Light::Id, gs::Vec2i>(
+										lightId, { xpos, ypos })
+								);
+							else 
+								tileColor = Light::lightSources[lightId]
+									.getColor({ xpos, ypos }); 
+						}
+
+						if (insideRegion)
+							world.setTileColor(xpos, ypos, tileColor); 
+					}
+				}
+
+				for (auto& [lightSourceIndex, position] : regionLights) {
+					forEachLitTile(Light::lightSources[lightSourceIndex], position,
+						[&](gs::Vec2i tilePosition, TileColor tileColor) {
+							if (!region.contains(tilePosition))
+								return; 
+
+							const TileColor baseColor = 
+								world.getTileColor(tilePosition); 
+
+							world.setTileColor(tilePosition,
+								maximizeColors(baseColor, tileColor));
+						}
+					); 
+				}
+
+				// The static colors of the region have changed, so dynamic 
+				// lights reaching into it are reapplied. 
+				for (auto staticTileColor = staticTileColors.begin(); 
+					staticTileColor != staticTileColors.end();) 
+				{
+					if (region.contains(staticTileColor->first))
+						staticTileColor = staticTileColors.erase(staticTileColor);
+					else
+						staticTileColor++; 
+				}
+				for (auto& dynamicLight : dynamicLights) {
+					if (dynamicLight.applied && sf::IntRect(
+						dynamicLight.position.x - margin, 
+						dynamicLight.position.y - margin, 
+						(2 * margin) + 1, (2 * margin) + 1).intersects(region))
+						applyDynamicLight(dynamicLight, world); 
+				}
+
+				dirtyLightArea += region.width * region.height; 
+			}
+			Light::Id getEntityLightId(const Player& playerEntity) {
+				const ItemContainer& itemContainer = 
+					playerEntity.getItemContainerSelected(); 
+
+				// Held items take priority over burning. 
+				if (itemContainer.count > 0) {
+					const Light::Id lightId = Light::getEntityLight(
+						Light::EntityBinding::Item, itemContainer.item.id); 
+
+					if (lightId != Light::None)
+						return lightId; 
+				}
+				if (playerEntity.isBurning())
+					return Light::getEntityLight(Light::EntityBinding::Burning); 
+
+				return Light::None; 
+			}
+			Light::Id getEntityLightId(const Mob& mobEntity) {
+				if (mobEntity.isBurning())
+					return Light::getEntityLight(Light::EntityBinding::Burning); 
+
+				return Light::None; 
+			}
+			Light::Id getEntityLightId(const ItemEntity& itemEntity) {
+				return Light::getEntityLight(Light::EntityBinding::Item, 
+					itemEntity.itemContainer.item.id); 
+			}
+			void applyDynamicLight(const DynamicLight& dynamicLight, World& world) {
+				forEachLitTile(Light::lightSources[dynamicLight.lightId], 
+					dynamicLight.position, 
+					[&](gs::Vec2i tilePosition, TileColor tileColor) {
+						const TileColor baseColor = world.getTileColor(tilePosition); 
+
+						// Only the first dynamic light to reach a tile sees it's
+						// static color. 
+						staticTileColors.emplace(tilePosition, baseColor); 
+						world.setTileColor(tilePosition, 
+							maximizeColors(baseColor, tileColor));
+					}
+				); 
+			}
+			void removeDynamicLight(const DynamicLight& dynamicLight, World& world) {
+				const Light& lightSource = Light::lightSources[dynamicLight.lightId]; 
+
+				forEachLitTile(lightSource, dynamicLight.position, 
+					[&](gs::Vec2i tilePosition, TileColor tileColor) {
+						const auto staticTileColor = 
+							staticTileColors.find(tilePosition); 
+
+						if (staticTileColor != staticTileColors.end())
+							world.setTileColor(tilePosition, staticTileColor->second);
+					}
+				); 
+
+				// Other dynamic lights overlapping the restored area are 
+				// reapplied on top of it. 
+				for (const auto& otherLight : dynamicLights) {
+					if (&otherLight == &dynamicLight || !otherLight.applied)
+						continue; 
+
+					const Light& otherLightSource = 
+						Light::lightSources[otherLight.lightId]; 
+					const int reach = lightSource.strength 
+						+ lightSource.centerRadius + otherLightSource.strength 
+							+ otherLightSource.centerRadius + 2; 
+
+					if (std::abs(otherLight.position.x - dynamicLight.position.x)
+						+ std::abs(otherLight.position.y 
+							- dynamicLight.position.y) < reach)
+						applyDynamicLight(otherLight, world); 
+				}
+			}
+			void updateDynamicLights(World& world) {
+				static size_t dynamicLightCursor = 0; 
+
+				for (auto& dynamicLight : dynamicLights)
+					dynamicLight.bound = false; 
+
+				// Binds lights to the entities currently carrying them. 
+				auto bindDynamicLight = [](Entity::Type entityType, 
+					EntityHandle entityHandle, const Entity& entity, 
+					Light::Id lightId) 
+				{
+					if (lightId == Light::None)
+						return; 
+
+					const gs::Vec2i position = gs::Vec2i(
+						std::floor(entity.position.x),
+						std::floor(entity.position.y)
+					); 
+					auto dynamicLight = std::find_if(dynamicLights.begin(), 
+						dynamicLights.end(), [&](const DynamicLight& light) {
+							return light.entityType == entityType 
+								&& light.entityHandle == entityHandle; 
+						}
+					); 
+
+					if (dynamicLight == dynamicLights.end()) {
+						dynamicLights.push_back({ 
+							entityType, entityHandle, lightId, position, 
+							lightId, position, false, true 
+						}); 
+					}
+					else {
+						dynamicLight->targetLightId = lightId; 
+						dynamicLight->targetPosition = position; 
+						dynamicLight->bound = true; 
+					}
+				}; 
+
+				bindDynamicLight(Entity::Type::PlayerEntity, EntityHandle(), 
+					*player, getEntityLightId(*player)); 
+
+				for (int mobIndex = 0; mobIndex < mobs.size(); mobIndex++)
+					bindDynamicLight(Entity::Type::Mob, mobs.getHandle(mobIndex), 
+						mobs[mobIndex], getEntityLightId(mobs[mobIndex])); 
+				for (int itemEntityIndex = 0; 
+					itemEntityIndex < itemEntities.size(); itemEntityIndex++) 
+				{
+					bindDynamicLight(Entity::Type::ItemEntity, 
+						itemEntities.getHandle(itemEntityIndex), 
+						itemEntities[itemEntityIndex], 
+						getEntityLightId(itemEntities[itemEntityIndex])); 
+				}
+
+				dynamicLightUpdates = 0; 
+
+				// Moves lights in a round robin, so no light is left waiting 
+				// when the budget runs out. 
+				size_t lightsVisited = 0; 
+
+				for (; lightsVisited < dynamicLights.size()
+					&& dynamicLightUpdates < maxDynamicLightUpdatesPerTick; 
+						lightsVisited++)
+				{
+					DynamicLight& dynamicLight = dynamicLights[
+						(dynamicLightCursor + lightsVisited) 
+							% dynamicLights.size()];
+
+					if (dynamicLight.applied && dynamicLight.bound 
+						&& dynamicLight.lightId == dynamicLight.targetLightId
+						&& dynamicLight.position == dynamicLight.targetPosition)
+						continue; 
+
+					if (dynamicLight.applied) {
+						removeDynamicLight(dynamicLight, world);
+						dynamicLight.applied = false; 
+					}
+					if (dynamicLight.bound) {
+						dynamicLight.lightId = dynamicLight.targetLightId; 
+						dynamicLight.position = dynamicLight.targetPosition; 
+						applyDynamicLight(dynamicLight, world); 
+						dynamicLight.applied = true; 
+					}
+
+					dynamicLightUpdates++; 
+				}
+
+				auto isLightUnused = [](const DynamicLight& dynamicLight) {
+					return !dynamicLight.bound && !dynamicLight.applied; 
+				}; 
+
+				if (dynamicLights.empty())
+					return; 
+
+				// The next tick starts after the last light visited. 
+				dynamicLightCursor = (dynamicLightCursor + lightsVisited) 
+					% dynamicLights.size(); 
+				// Keeps the cursor on the same light once the lights before 
+				// it are removed. 
+				dynamicLightCursor -= std::count_if(dynamicLights.begin(), 
+					dynamicLights.begin() + dynamicLightCursor, isLightUnused); 
+
+				// Removes lights which are no longer attached or lit. 
+				dynamicLights.erase(std::remove_if(dynamicLights.begin(),
+					dynamicLights.end(), isLightUnused), dynamicLights.end()); 
+
+				if (dynamicLightCursor >= dynamicLights.size())
+					dynamicLightCursor = 0; 
+			}
 			void updateWorldLights(World& world) {
 				// Exits function if full bright is enabled. 
 				if (fullBrightEnabled) {
@@ -143,15 +472,39 @@ namespace engine {
 				// the number of lights rendered in the prvs frame. 
 				lightUpdateRate = std::min((lightsRendered / 30) + 2, 20); 
 
-				if (forceLights) {
-					ticksUntilNextLightingUpdate = 0;
-					forceLights = false;
+				const sf::IntRect lightRange = sf::IntRect(
+					renderableHorizontalLightRange.x, 
+					renderableVerticalLightRange.x,
+					renderableHorizontalLightRange.y 
+						- renderableHorizontalLightRange.x, 
+					renderableVerticalLightRange.y 
+						- renderableVerticalLightRange.x
+				); 
+				int dirtyLightRangeArea = 0; 
+
+				for (auto& dirtyRegion : dirtyLightRegions) {
+					sf::IntRect visibleRegion; 
+
+					// Dirty regions are clipped to what is visible. 
+					if (dirtyRegion.intersects(lightRange, visibleRegion)) {
+						dirtyRegion = visibleRegion; 
+						dirtyLightRangeArea += 
+							visibleRegion.width * visibleRegion.height; 
+					}
+					else
+						dirtyRegion = sf::IntRect(); 
 				}
 
+				// Relights everything at once if most of the view is dirty. 
+				if (dirtyLightRangeArea * 2 >= lightRange.width 
+					* lightRange.height && dirtyLightRangeArea > 0)
+					ticksUntilNextLightingUpdate = 0;
+
+				dirtyLightArea = 0; 
+
 				if (ticksUntilNextSpawningLightingUpdate == 0) {
-					updateSpawningLights(world); 
+					updateSpawningLightColors(); 
 
-					ticksUntilNextLightingUpdate = lightUpdateRate; 
 					ticksUntilNextSpawningLightingUpdate = 
 						timeBetweenSpawnLightingUpdates; 
 				}
@@ -160,6 +513,12 @@ namespace engine {
 					lights.clear(); 
 					lightsRendered = 0; 
 
+					// Sunlight changes throughout the day. 
+					Light& sunlight = Light::lightSources[Light::Sunlight]; 
+
+					if (sunlight.isFalloffStale())
+						sunlight.bakeFalloff(); 
+
 					for (int xpos = renderableHorizontalLightRange.x; xpos <
 						renderableHorizontalLightRange.y; xpos++)
 					{
@@ -176,31 +535,133 @@ namespace engine {
 						applyLight(lightSource, position, world); 
 					}
 
+					// Dynamic lights are reapplied over the fresh static 
+					// lighting where they currently are. 
+					staticTileColors.clear(); 
+
+					for (auto& dynamicLight : dynamicLights) {
+						if (dynamicLight.applied)
+							applyDynamicLight(dynamicLight, world); 
+					}
+
 					ticksUntilNextLightingUpdate = lightUpdateRate;
+					dirtyLightArea = lightRange.width * lightRange.height; 
 				}
+				else {
+					for (auto& dirtyRegion : dirtyLightRegions) {
+						if (dirtyRegion.width > 0 && dirtyRegion.height > 0)
+							relightRegion(dirtyRegion, world); 
+					}
+				}
+
+				dirtyLightRegions.clear(); 
+
+				updateDynamicLights(world); 
 
 				ticksUntilNextLightingUpdate--;
 				ticksUntilNextSpawningLightingUpdate--; 
 			}
-			void updateSpawningLights(World& world) {
-				lights.clear(); 
+			TileColor getSpawningLightColor(gs::Vec2i position) {
+				const gs::Vec2i localPosition = 
+					position - spawningLightOrigin; 
+
+				// Tiles outside of the field are treated as fully lit so 
+				// nothing spawns where the light levels are unknown. 
+				if (localPosition.x < 0 || localPosition.y < 0 
+					|| localPosition.x >= spawningLightSize.x
+					|| localPosition.y >= spawningLightSize.y)
+					return TileColor(255, 255, 255); 
+
+				return spawningLightColors[
+					localPosition.x * spawningLightSize.y + localPosition.y
+				]; 
+			}
+			TileColor getSpawningLightColor(int xpos, int ypos) {
+				return getSpawningLightColor(gs::Vec2i(xpos, ypos)); 
+			}
+			void applySpawningLightColor(const Light& lightSource, gs::Vec2i position) {
+				const bool smooth = lightingStyle == LightingStyle::Smooth; 
+				const int size = lightSource.getFalloffSize(smooth); 
+				// Flickering is ignored, so the first phase is always used. 
+				const TileColor* falloff = lightSource.getFalloff(smooth, 0); 
+
+				for (int xpos = std::max(position.x - size + 1, 
+					spawningLightOrigin.x); xpos < std::min(position.x 
+						+ size, spawningLightOrigin.x 
+							+ spawningLightSize.x); xpos++) 
+				{
+					const int xDistance = std::abs(xpos - position.x); 
+					// Vertical distance away from the center. 
+					const int yDelta = size - 1 - xDistance; 
+					TileColor* column = &spawningLightColors[(xpos 
+						- spawningLightOrigin.x) * spawningLightSize.y]; 
+
+					for (int ypos = std::max(position.y - yDelta, 
+						spawningLightOrigin.y); ypos < std::min(position.y 
+							+ yDelta + 1, spawningLightOrigin.y 
+								+ spawningLightSize.y); ypos++)
+					{
+						TileColor& tileColor = 
+							column[ypos - spawningLightOrigin.y]; 
+
+						tileColor = maximizeColors(tileColor, 
+							falloff[xDistance + std::abs(ypos - position.y)]); 
+					}
+				}
+			}
+			void resetSpawningLightColors() {
+				spawningLightColors.clear(); 
+				spawningLightSize = gs::Vec2i(); 
+				// Fills the field on the next lighting update, rather than 
+				// blocking hostile spawns until the usual interval passes. 
+				ticksUntilNextSpawningLightingUpdate = 0; 
+			}
+			void updateSpawningLightColors() {
+				spawningLightOrigin = gs::Vec2i(
+					renderableHorizontalSpawningLightRange.x,
+					renderableVerticalSpawningLightRange.x
+				); 
+				spawningLightSize = gs::Vec2i(
+					renderableHorizontalSpawningLightRange.y 
+						- renderableHorizontalSpawningLightRange.x,
+					std::max(renderableVerticalSpawningLightRange.y
+						- renderableVerticalSpawningLightRange.x, 0)
+				); 
+				spawningLightColors.assign(
+					spawningLightSize.x * spawningLightSize.y, ambientLightColor
+				); 
+
+				// Sunlight changes throughout the day. 
+				Light& sunlight = Light::lightSources[Light::Sunlight]; 
+
+				if (sunlight.isFalloffStale())
+					sunlight.bakeFalloff(); 
 
 				for (int xpos = renderableHorizontalSpawningLightRange.x;
 					xpos < renderableHorizontalSpawningLightRange.y; xpos++)
 				{
 					for (int ypos = renderableVerticalSpawningLightRange.x;
-							ypos < renderableVerticalSpawningLightRange.y; ypos++)
-						attemptLight({ xpos, ypos });
-				}
+						ypos < renderableVerticalSpawningLightRange.y; ypos++)
+					{
+						const Light::Id lightId = getTileLightId({ xpos, ypos }); 
 
-				// Applies all current light sources. 
-				for (auto& [lightSourceIndex, position] : lights) {
-					const Light& lightSource =
-						Light::lightSources[lightSourceIndex];
+						if (lightId == Light::None)
+							continue; 
+
+						const Light& lightSource = Light::lightSources[lightId];
 
-					applyLight(lightSource, position, world);
-					// Doesn't count these lights as part of the total. 
-					lightsRendered--; 
+						if (isValidLight({ xpos, ypos }, lightId))
+							applySpawningLightColor(lightSource, { xpos, ypos }); 
+						else {
+							TileColor& tileColor = spawningLightColors[(xpos 
+								- spawningLightOrigin.x) 
+									* spawningLightSize.y + (ypos 
+										- spawningLightOrigin.y)]; 
+
+							tileColor = maximizeColors(tileColor, 
+								lightSource.getFalloff(false, 0)[0]); 
+						}
+					}
 				}
 			}
 		}
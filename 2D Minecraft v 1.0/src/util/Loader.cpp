@@ -13,15 +13,27 @@ namespace engine {
 	const PairVector& loadPairedFile(
 		const std::string& filename, char seperator, const std::string& end, 
 		bool removeSpaces)
+	{
+		std::ifstream ifile(filename);
+		const PairVector& pairs = loadPairedStream(
+			ifile, seperator, end, removeSpaces
+		); 
+
+		ifile.close(); 
+
+		return pairs; 
+	}
+	const PairVector& loadPairedStream(
+		std::istream& istream, char seperator, const std::string& end, 
+		bool removeSpaces)
 	{
 		static PairVector pairs; 
 
-		std::ifstream ifile(filename);
 		std::string line; 
 
 		pairs.clear(); 
 
-		while (std::getline(ifile, line)) {
+		while (std::getline(istream, line)) {
 			std::string trimmedLine; 
 			bool seperatorFound = false;
 			bool pastSeperatorGap = false;
@@ -50,8 +62,6 @@ namespace engine {
 			pairs.push_back(pair); 
 		}
 
-		ifile.close(); 
-
 		return pairs; 
 	}
 	void savePairedFile(
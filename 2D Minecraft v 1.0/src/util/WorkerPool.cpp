@@ -0,0 +1,112 @@
+#include "../../hdr/util/WorkerPool.hpp"
+
+namespace engine {
+	WorkerPool::WorkerPool(int numOfWorkers) :
+		numOfWorkers(numOfWorkers), 
+		task(nullptr), 
+		taskCount(0), 
+		nextTaskIndex(0), 
+		numOfActiveWorkers(0), 
+		generation(0), 
+		stopping(false)
+	{
+	}
+	WorkerPool::~WorkerPool() {
+		{
+			std::lock_guard<std::mutex> lock(mutex); 
+			stopping = true; 
+		}
+
+		tasksAvailable.notify_all(); 
+
+		for (std::thread& worker : workers)
+			worker.join(); 
+	}
+
+	void WorkerPool::parallelFor(
+		int count, const std::function<void(int)>& task) 
+	{
+		if (count <= 0)
+			return; 
+		// Not worth waking the workers for a single task. 
+		if (count == 1 || numOfWorkers == 0) {
+			for (int taskIndex = 0; taskIndex < count; taskIndex++)
+				task(taskIndex); 
+
+			return; 
+		}
+
+		if (workers.empty())
+			startWorkers(); 
+
+		{
+			std::lock_guard<std::mutex> lock(mutex); 
+
+			this->task = &task; 
+			taskCount = count; 
+			nextTaskIndex = 0; 
+			numOfActiveWorkers = workers.size(); 
+			generation++; 
+		}
+
+		tasksAvailable.notify_all(); 
+		runTasks(); 
+
+		std::unique_lock<std::mutex> lock(mutex); 
+
+		tasksFinished.wait(lock, [this]() -> bool {
+			return numOfActiveWorkers == 0; 
+		}); 
+		this->task = nullptr; 
+	}
+
+	int WorkerPool::getNumOfWorkers() const {
+		return numOfWorkers; 
+	}
+
+	int WorkerPool::getDefaultNumOfWorkers() {
+		// Leaves one core for the calling thread. 
+		const int numOfCores = std::thread::hardware_concurrency(); 
+		return std::clamp(numOfCores - 1, 0, maxNumOfWorkers); 
+	}
+
+	void WorkerPool::startWorkers() {
+		workers.reserve(numOfWorkers); 
+
+		for (int workerIndex = 0; workerIndex < numOfWorkers; workerIndex++)
+			workers.emplace_back(&WorkerPool::work, this); 
+	}
+	void WorkerPool::work() {
+		unsigned int finishedGeneration = 0; 
+
+		while (true) {
+			{
+				std::unique_lock<std::mutex> lock(mutex); 
+
+				tasksAvailable.wait(lock, [&]() -> bool {
+					return stopping || generation != finishedGeneration;
+				}); 
+
+				if (stopping)
+					return; 
+
+				finishedGeneration = generation; 
+			}
+
+			runTasks(); 
+
+			std::lock_guard<std::mutex> lock(mutex); 
+
+			if (--numOfActiveWorkers == 0)
+				tasksFinished.notify_one(); 
+		}
+	}
+	void WorkerPool::runTasks() {
+		int taskIndex; 
+
+		while ((taskIndex = nextTaskIndex++) < taskCount)
+			(*task)(taskIndex); 
+	}
+
+	WorkerPool workerPool; 
+}
\ No newline at end of file
@@ -6,7 +6,8 @@ namespace engine {
 	Chunk::Chunk() : 
 		offset(0),
 		loadedFromSave(false), 
-		needsToBeSaved(true)
+		needsToBeSaved(true), 
+		entityFileHash(0)
 	{
 	}
 	Chunk::Chunk(int offset) : offset(offset) {
@@ -52,15 +53,21 @@ namespace engine {
 	}
 
 	void Chunk::setBlock(gs::Vec2i position, Block block) {
+		const Block prvsBlock = blocks[position.x][position.y]; 
+
 		blocks[position.x][position.y] = block;
 		needsToBeSaved = true; 
+		invalidateBlockChanges(position, prvsBlock); 
 	}
 	void Chunk::setBlock(int xpos, int ypos, Block block) {
 		setBlock({ xpos, ypos }, block);
 	}
 	void Chunk::setBlockId(gs::Vec2i position, Block::Id blockId) {
+		const Block prvsBlock = blocks[position.x][position.y]; 
+
 		blocks[position.x][position.y].id = blockId;
 		needsToBeSaved = true;
+		invalidateBlockChanges(position, prvsBlock); 
 	}
 	void Chunk::setBlockId(int xpos, int ypos, Block::Id blockId) {
 		setBlockId({ xpos, ypos }, blockId);
@@ -68,6 +75,7 @@ namespace engine {
 	void Chunk::setWall(gs::Vec2i position, Wall wall) {
 		walls[position.x][position.y] = wall;
 		needsToBeSaved = true;
+		invalidateMesh(position); 
 	}
 	void Chunk::setWall(int xpos, int ypos, Wall wall) {
 		setWall({ xpos, ypos }, wall);
@@ -75,6 +83,7 @@ namespace engine {
 	void Chunk::setWallId(gs::Vec2i position, Wall::Id wallId) {
 		walls[position.x][position.y].id = wallId;
 		needsToBeSaved = true;
+		invalidateMesh(position); 
 	}
 	void Chunk::setWallId(int xpos, int ypos, Wall::Id wallId) {
 		setWallId({ xpos, ypos }, wallId);
@@ -160,6 +169,80 @@ namespace engine {
 		return biome.id; 
 	}
 
+	bool Chunk::isMeshSectionBuilt(int sectionIndex) const {
+		return meshSectionsBuilt[sectionIndex]; 
+	}
+	void Chunk::setMeshSectionBuilt(int sectionIndex, bool built) const {
+		meshSectionsBuilt[sectionIndex] = built; 
+	}
+	bool Chunk::isImpostorBuilt() const {
+		return impostorBuilt; 
+	}
+	void Chunk::setImpostorBuilt(bool built) const {
+		impostorBuilt = built; 
+	}
+	void Chunk::invalidateMesh(gs::Vec2i position) {
+		meshSectionsBuilt[position.y / meshSectionHeight] = false; 
+		impostorBuilt = false; 
+
+		// Fluids check the tile above them, so the next section can change
+		// too. 
+		if (position.y + 1 < height)
+			meshSectionsBuilt[(position.y + 1) / meshSectionHeight] = false; 
+	}
+	void Chunk::invalidateBlockChanges(gs::Vec2i position, Block prvsBlock) {
+		const Block& block = blocks[position.x][position.y]; 
+
+		if (block.id != prvsBlock.id 
+			|| block.tags.ignoreCollision != prvsBlock.tags.ignoreCollision)
+		{
+			// Line of sight and navigation only depend on which tiles are 
+			// solid or lava, so other edits keep the cached results valid. 
+			auto isSolid = [](Block block) {
+				return block.id > Block::Air && block.isSolid(); 
+			}; 
+
+			invalidateMesh(position); 
+			invalidateBlockCaches(position); 
+
+			if (isSolid(block) != isSolid(prvsBlock) 
+				|| (block.id == Block::Lava) != (prvsBlock.id == Block::Lava)
+				|| block.tags.ignoreCollision != prvsBlock.tags.ignoreCollision)
+				blockEditStamp = ++numOfBlockEdits; 
+		}
+		else if (block.tags.animationOffset != prvsBlock.tags.animationOffset
+			|| block.tags.rotation != prvsBlock.tags.rotation
+			|| block.tags.fluidLevel != prvsBlock.tags.fluidLevel
+			|| block.tags.isFluidSource != prvsBlock.tags.isFluidSource)
+		{
+			invalidateMesh(position); 
+		}
+	}
+	std::uint8_t Chunk::getNavigationCell(int xpos, int ypos) const {
+		return navigationCells[xpos][ypos]; 
+	}
+	void Chunk::setNavigationCell(
+		int xpos, int ypos, std::uint8_t cell) const 
+	{
+		navigationCells[xpos][ypos] = cell; 
+	}
+	bool Chunk::isNavigationColumnBuilt(int xpos) const {
+		return navigationColumnsBuilt[xpos]; 
+	}
+	void Chunk::setNavigationColumnBuilt(int xpos, bool built) const {
+		navigationColumnsBuilt[xpos] = built; 
+	}
+	void Chunk::invalidateBlockCaches(gs::Vec2i position) {
+		// Navigation cells only depend on the tiles above and below them, 
+		// so just the column needs to be rebuilt. 
+		navigationColumnsBuilt[position.x] = false; 
+	}
+	unsigned int Chunk::getBlockEditStamp() const {
+		return blockEditStamp; 
+	}
+
+	unsigned int Chunk::numOfBlockEdits = 0; 
+
 	void Chunk::clear() {
 		for (int xpos = 0; xpos < width; xpos++) {
 			for (int ypos = 0; ypos < height; ypos++) {
@@ -2,9 +2,12 @@
 
 namespace engine {
 	size_t HashContainer::operator()(const gs::Vec2i& vec) const {
-		// Used this post as a reference to make hash for 2 component vector. 
-		// https://stackoverflow.com/questions/45395071/hash-for-a-stdpair-for-use-in-an-unordered-map
-		return size_t(vec.x) << 32 | vec.y;
+		// Packs both components into one integer, the ypos is made unsigned
+		// so a negative value doesn't overwrite the xpos. 
+		return std::hash<long long>()(
+			(static_cast<long long>(vec.x) << 32) 
+				| static_cast<unsigned int>(vec.y)
+		);
 	}
 
 	PathFinder::PathFinder() :
@@ -13,6 +16,7 @@ namespace engine {
 		restrictions(sf::IntRect(-1, -1, -1, -1)),
 		safeBlockFilter([](Block block) -> bool { return block.isEmpty(); }),
 		unsafeBlockFilter([](Block block) -> bool { return false; }),
+		frontierIndex(0), 
 		boundsReached(false),
 		endPointReached(false)
 	{
@@ -24,14 +28,14 @@ namespace engine {
 		restrictions = sf::IntRect(-1, -1, -1, -1); 
 	}
 	bool PathFinder::isBlockLocatable(Block::Id blockId, int limit) {
-		initSearch(); 
+		initSearch(limit); 
 		endBlockId = blockId; 
 		while (!breadthFlood() && (limit == -1 ? true 
 			: searched.size() < limit));
 		return endPointReached; 
 	}
 	int PathFinder::calculateAreaVolume(int limit) {
-		initSearch(); 
+		initSearch(limit); 
 		while (!breadthFlood() && searched.size() < limit); 
 		return searched.size();
 	}
@@ -50,92 +54,134 @@ namespace engine {
 		return boundsReached;
 	}
 
+	thread_local std::vector<gs::Vec2i> PathFinder::searched; 
+	thread_local std::vector<int> PathFinder::visitStamps; 
+	thread_local std::vector<int> PathFinder::parentIndices; 
+	thread_local int PathFinder::searchStamp = 0; 
+
 	bool PathFinder::isPositionWithinBounds(gs::Vec2i position) const {
-		return position.y >= 0 && position.y < Chunk::height
-			&& (restrictions.left == -1 || position.x >= restrictions.left)
-			&& (restrictions.top == -1 || position.y >= restrictions.top)
-			&& (restrictions.width == -1 || position.x <= restrictions.width)
-			&& (restrictions.height == -1 || position.y <= restrictions.height); 
+		return position.x >= searchRegion.left 
+			&& position.x < searchRegion.left + searchRegion.width
+			&& position.y >= searchRegion.top 
+			&& position.y < searchRegion.top + searchRegion.height; 
+	}
+	int PathFinder::getRegionIndex(gs::Vec2i position) const {
+		return ((position.x - searchRegion.left) * searchRegion.height) 
+			+ (position.y - searchRegion.top); 
+	}
+	gs::Vec2i PathFinder::getRegionPosition(int regionIndex) const {
+		return gs::Vec2i(
+			searchRegion.left + (regionIndex / searchRegion.height), 
+			searchRegion.top + (regionIndex % searchRegion.height)
+		); 
 	}
 
 	void PathFinder::clearSearch() {
-		while (!frontier.empty())
-			frontier.pop(); 
-
 		searched.clear(); 
-		pathMap.clear(); 
 		path.clear(); 
+		frontierIndex = 0; 
 	}
-	void PathFinder::initSearch() {
+	void PathFinder::initSearch(int limit) {
+		// A flood can't travel further than the number of blocks it's 
+		// allowed to search, plus the neighbors found on it's last step. 
+		const int searchRadius = limit == -1 
+			? World::chunkUnloadDistance * Chunk::width * 2 : limit + 4; 
+
+		const int left = restrictions.left != -1 ? restrictions.left 
+			: startPoint.x - searchRadius; 
+		const int right = restrictions.width != -1 ? restrictions.width 
+			: startPoint.x + searchRadius; 
+		const int top = std::max(restrictions.top != -1 ? restrictions.top 
+			: startPoint.y - searchRadius, 0); 
+		const int bottom = std::min(restrictions.height != -1 
+			? restrictions.height : startPoint.y + searchRadius, 
+			Chunk::height - 1); 
+
 		clearSearch(); 
 
-		frontier.push(startPoint); 
-		searched.push_back(startPoint); 
-		pathMap[startPoint] = startPoint; 
+		searchRegion = sf::IntRect(
+			left, top, std::max(right - left + 1, 0), 
+			std::max(bottom - top + 1, 0)
+		); 
+
+		const size_t regionSize = static_cast<size_t>(searchRegion.width) 
+			* searchRegion.height; 
+
+		// The region only grows the shared state, stale stamps are ignored.
+		if (visitStamps.size() < regionSize) {
+			visitStamps.resize(regionSize, 0); 
+			parentIndices.resize(regionSize); 
+		}
+
+		searchStamp++; 
 		boundsReached = false; 
 		endPointReached = false; 
+
+		if (isPositionWithinBounds(startPoint))
+			visit(startPoint, -1); 
+	}
+	void PathFinder::visit(gs::Vec2i position, int parentIndex) {
+		const int regionIndex = getRegionIndex(position); 
+
+		visitStamps[regionIndex] = searchStamp; 
+		parentIndices[regionIndex] = parentIndex; 
+		searched.push_back(position); 
 	}
 
 	bool PathFinder::breadthFlood() {
-		if (!frontier.empty()) {
-			gs::Vec2i currentPosition = frontier.front(); 
-			frontier.pop();
+		// The searched blocks double as the queue of blocks to flood from. 
+		if (frontierIndex == searched.size())
+			return true; 
 
-			if (currentPosition == endPoint
-				|| world->getBlock(currentPosition).id == endBlockId)
+		const gs::Vec2i currentPosition = searched[frontierIndex]; 
+		const int currentIndex = getRegionIndex(currentPosition); 
+
+		frontierIndex++; 
+
+		if (currentPosition == endPoint
+			|| world->getBlock(currentPosition).id == endBlockId)
+		{
+			endPointReached = true; 
+
+			for (int regionIndex = currentIndex; regionIndex != -1; 
+				regionIndex = parentIndices[regionIndex])
 			{
-				endPointReached = true; 
-				return true;
+				path.push_back(getRegionPosition(regionIndex)); 
 			}
 
-			gs::Vec2i neighborPositions[4]; 
-			int validNeighbors = 0; 
-
-			for (int neighborIndex = 0; neighborIndex < 4; neighborIndex++) {
-				gs::Vec2i neighborPosition = currentPosition;
-
-				if (neighborIndex % 2 == 0)
-					neighborPosition.y += neighborIndex == 0 ? -1 : 1;
-				else
-					neighborPosition.x += neighborIndex == 1 ? 1 : -1;
-
-				if (world->getChunk(world->getChunkOffset(neighborPosition.x)) 
-						== nullptr)
-					boundsReached = true; 
-				else if (isPositionWithinBounds(neighborPosition)) {
-					const Block neighborBlock = 
-						world->getBlock(neighborPosition); 
-
-					if (unsafeBlockFilter(neighborBlock)) {
-						clearSearch(); 
-						return true; 
-					}
-
-					if (safeBlockFilter(neighborBlock)) {
-						neighborPositions[validNeighbors] = neighborPosition;
-						validNeighbors++;
-					}
-				}
+			std::reverse(path.begin(), path.end()); 
+			return true;
+		}
+
+		for (int neighborIndex = 0; neighborIndex < 4; neighborIndex++) {
+			gs::Vec2i neighborPosition = currentPosition;
 
-				for (int nextPositionIndex = 0; nextPositionIndex <
-					validNeighbors; nextPositionIndex++)
-				{
-					const gs::Vec2i nextPosition = 
-						neighborPositions[nextPositionIndex]; 
-
-					if (std::find(searched.begin(), searched.end(),
-						nextPosition) == searched.end())
-					{
-						frontier.push(nextPosition); 
-						searched.push_back(nextPosition); 
-						pathMap[nextPosition] = currentPosition; 
-					}
+			if (neighborIndex % 2 == 0)
+				neighborPosition.y += neighborIndex == 0 ? -1 : 1;
+			else
+				neighborPosition.x += neighborIndex == 1 ? 1 : -1;
+
+			if (world->getChunk(world->getChunkOffset(neighborPosition.x)) 
+					== nullptr)
+				boundsReached = true; 
+			else if (isPositionWithinBounds(neighborPosition)) {
+				// Blocks already visited were safe when first checked. 
+				if (visitStamps[getRegionIndex(neighborPosition)] 
+						== searchStamp)
+					continue; 
+
+				const Block neighborBlock = world->getBlock(neighborPosition); 
+
+				if (unsafeBlockFilter(neighborBlock)) {
+					clearSearch(); 
+					return true; 
 				}
-			}
 
-			return false; 
+				if (safeBlockFilter(neighborBlock))
+					visit(neighborPosition, currentIndex); 
+			}
 		}
 
-		return true; 
+		return false; 
 	}
 }
\ No newline at end of file
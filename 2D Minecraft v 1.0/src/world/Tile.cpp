@@ -233,6 +233,8 @@ namespace engine {
 				blockInfo->setVar(property, std::stof(value)); 
 			}
 		}
+
+		collision::loadTileCollisions(); 
 	}	
 	void loadWallInfo() {
 		const PairVector& pairs = loadPairedFile(
@@ -3,6 +3,7 @@
 #include "../../hdr/graphics/UI.hpp"
 #include "../../hdr/entity/Collision.hpp"
 #include "../../hdr/audio/AudioEnviroment.hpp"
+#include "../../hdr/graphics/lighting/Lighting.hpp"
 
 namespace engine {
 	World::World() :
@@ -26,6 +27,7 @@ namespace engine {
 
 		// Creates the file directories to ensure data can be written to.  
 		createWorldFileDirectories();
+		render::lighting::resetSpawningLightColors(); 
 	}
 	void World::loadWorld(const std::string& folderName) {
 		saveFileDirectory = "saves/" + folderName;
@@ -39,6 +41,7 @@ namespace engine {
 
 		// Creates the file directories to ensure data can be written to.  
 		createWorldFileDirectories(); 
+		render::lighting::resetSpawningLightColors(); 
 	}
 	void World::saveWorld() {
 		createWorldFileDirectories();
@@ -643,7 +646,14 @@ namespace engine {
 		Chunk* chunk = getChunk(getChunkOffset(position.x)); 
 
 		if (chunk != nullptr && isValidYpos(position.y)) [[likely]] {
+			const Block prvsBlock = chunk->getBlock(getChunkPosition(position)); 
+
 			chunk->setBlock(getChunkPosition(position), block); 
+
+			if (render::lighting::getBlockLightId(prvsBlock) 
+					!= render::lighting::getBlockLightId(block))
+				render::lighting::markLightingDirty(position); 
+
 			return true; 
 		}
 
@@ -656,7 +666,14 @@ namespace engine {
 		Chunk* chunk = getChunk(getChunkOffset(position.x)); 
 
 		if (chunk != nullptr && isValidYpos(position.y)) [[likely]] {
+			const Block prvsBlock = chunk->getBlock(getChunkPosition(position)); 
+
 			chunk->setBlockId(getChunkPosition(position), blockId); 
+
+			if (render::lighting::getBlockLightId(prvsBlock) 
+					!= render::lighting::getBlockLightId(Block(blockId)))
+				render::lighting::markLightingDirty(position); 
+
 			return true; 
 		}
 
@@ -669,7 +686,14 @@ namespace engine {
 		Chunk* chunk = getChunk(getChunkOffset(position.x)); 
 
 		if (chunk != nullptr && isValidYpos(position.y)) [[likely]] {
+			const Wall prvsWall = chunk->getWall(getChunkPosition(position)); 
+
 			chunk->setWall(getChunkPosition(position), wall); 
+
+			// Walls only affect lighting by blocking sunlight. 
+			if (prvsWall.isEmpty() != wall.isEmpty())
+				render::lighting::markLightingDirty(position); 
+
 			return true; 
 		}
 
@@ -682,7 +706,13 @@ namespace engine {
 		Chunk* chunk = getChunk(getChunkOffset(position.x)); 
 
 		if (chunk != nullptr && isValidYpos(position.y)) [[likely]] {
+			const Wall prvsWall = chunk->getWall(getChunkPosition(position)); 
+
 			chunk->setWallId(getChunkPosition(position), wallId); 
+
+			if (prvsWall.isEmpty() != Wall(wallId).isEmpty())
+				render::lighting::markLightingDirty(position); 
+
 			return true; 
 		}
 
@@ -725,6 +755,12 @@ namespace engine {
 	Block& World::getBlockRef(int xpos, int ypos) {
 		return getBlockRef({ xpos, ypos }); 
 	}
+	void World::invalidateBlockChanges(gs::Vec2i position, Block prvsBlock) {
+		Chunk* chunk = getChunk(getChunkOffset(position.x));
+
+		if (chunk != nullptr && isValidYpos(position.y))
+			chunk->invalidateBlockChanges(getChunkPosition(position), prvsBlock); 
+	}
 	Block::Id World::getBlockId(gs::Vec2i position) const {
 		const Chunk* chunk = getChunk(getChunkOffset(position.x)); 
 
@@ -970,11 +1006,25 @@ namespace engine {
 		const std::filesystem::path pathname = 
 			getChunkEntitySaveFileName(chunk.offset);
 
+		chunk.entityFileHash = 0; 
+
 		// Stops loading process if the chunk entity file doesn't exist. 
 		if (!std::filesystem::exists(pathname))
 			return false;
 
-		const PairVector& pairs = loadPairedFile(pathname.generic_string());
+		std::ifstream ifile(pathname); 
+		std::ostringstream entityData; 
+
+		entityData << ifile.rdbuf(); 
+		ifile.close(); 
+
+		// The file is only read once, for both it's hash and it's contents. 
+		const std::string entityFileContents = entityData.str(); 
+		std::istringstream entityStream(entityFileContents); 
+
+		chunk.entityFileHash = std::hash<std::string>()(entityFileContents); 
+
+		const PairVector& pairs = loadPairedStream(entityStream);
 
 		ReadState readState = TileEntity_;
 		gs::Vec2i chunkPosition;
@@ -983,10 +1033,23 @@ namespace engine {
 		TileEntity tileEntity; 
 		bool createNewTileEntity = false;
 		Entity* entity = nullptr; 
-		Mob* mobEntity = nullptr; 
-		ItemEntity* itemEntity = nullptr; 
+		Mob mobEntity; 
+		ItemEntity itemEntity; 
 		Entity::Type entityType = Entity::Type::None; 
 
+		// Copies the entity that was read into it's pool. 
+		auto addLoadedEntity = [&]() {
+			switch (entityType) {
+			case Entity::Type::Mob:
+				mobEntity.init(); 
+				mobGrid.add(mobEntity); 
+				break; 
+			case Entity::Type::ItemEntity:
+				itemEntityGrid.add(itemEntity); 
+				break; 
+			}
+		}; 
+
 		for (auto& [attribute, value] : pairs) {
 			switch (readState) {
 			case TileEntity_:
@@ -1055,8 +1118,8 @@ namespace engine {
 			case Entity_:
 			{
 				if (attribute == "NewEntity") {
-					if (entityType != Entity::Type::None) {
-						addEntity(entityType, entity);
+					if (entity != nullptr) {
+						addLoadedEntity(); 
 						entity = nullptr; 
 					}
 				}
@@ -1065,12 +1128,14 @@ namespace engine {
 
 					switch (entityType) {
 					case Entity::Type::Mob:
-						mobEntity = new Mob(); 
-						entity = mobEntity; 
+						mobEntity = Mob(); 
+						entity = &mobEntity; 
 						break; 
 					case Entity::Type::ItemEntity:
-						itemEntity = new ItemEntity();
-						entity = itemEntity;
+						itemEntity = ItemEntity();
+						// Loaded item entities stay where they were saved. 
+						itemEntity.velocity = gs::Vec2f(); 
+						entity = &itemEntity;
 						break;
 					}
 				}
@@ -1089,21 +1154,23 @@ namespace engine {
 						switch (entityType) {
 						case Entity::Type::Mob:
 							if (attribute == "mobType")
-								mobEntity->type = 
+								mobEntity.type = 
 									static_cast<Mob::Type>(std::stoi(value)); 
 							break;
 						case Entity::Type::ItemEntity:
 							if (attribute == "itemId")
-								itemEntity->itemContainer.item.id =
+								itemEntity.itemContainer.item.id =
 									static_cast<Item::Id>(std::stoi(value));
 							else if (attribute == "itemTags")
-								itemEntity->itemContainer.item.tags.asInt =
+								itemEntity.itemContainer.item.tags.asInt =
 									std::stoull(value);
 							else if (attribute == "itemCount")
-								itemEntity->itemContainer.count =
+								itemEntity.itemContainer.count =
 									std::stoi(value);
 							else if (attribute == "timeLeft")
-								itemEntity->timeLeft = std::stoi(value);
+								// Pickup delays used to be stored as extra time. 
+								itemEntity.timeLeft = std::min(std::stoi(value), 
+									ItemEntity::defaultNumberOfTicksAlive);
 							break;
 						}
 					}
@@ -1117,7 +1184,7 @@ namespace engine {
 		if (createNewTileEntity) 
 			addTileEntity(tileEntity); 
 		if (entity != nullptr) 
-			addEntity(entityType, entity); 
+			addLoadedEntity(); 
 
 		return true;
 	}
@@ -1305,10 +1372,11 @@ namespace engine {
 		ofile.close(); 
 	}
 	void World::saveChunkEntities(const Chunk& chunk) {
-		std::ofstream ofile(getChunkEntitySaveFileName(chunk.offset));
+		static std::vector<EntityHandle> chunkEntityHandles; 
+		std::ostringstream entityData; 
 
 		// Save tile entity data. 
-		ofile << "\nTileEntity\n";
+		entityData << "\nTileEntity\n";
 
 		const TileEntity* tileEntity = nullptr;
 		int tileEntityIndex = 0;
@@ -1317,49 +1385,53 @@ namespace engine {
 			tileEntity = chunk.getTileEntity(tileEntityIndex);
 
 			if (tileEntity != nullptr) 
-				ofile << "\n" << tileEntity->getSaveString() << "\n"; 
+				entityData << "\n" << tileEntity->getSaveString() << "\n"; 
 
 			tileEntityIndex++; 
 		}
 		while (tileEntity != nullptr);
 
 		// Save entity data. 
-		ofile << "\nEntity\n";
+		entityData << "\nEntity\n";
 
-		for (int entityPairIndex = 1; entityPairIndex < entities.size();
-			entityPairIndex++)
-		{
-			const EntityPair& entityPair = entities[entityPairIndex];
+		// Entities in the chunk are unloaded as they're saved. 
+		mobGrid.getChunkHandles(chunk.offset, chunkEntityHandles); 
 
-			Entity::Type entityType = entityPair.first;
-			Entity* entity = entityPair.second;
+		for (EntityHandle mobHandle : chunkEntityHandles) {
+			const int mobIndex = mobs.getIndex(mobHandle); 
+			const Mob& mob = mobs[mobIndex]; 
 
-			if (getChunkOffset(entity->position.x) == chunk.offset) {
-				// True if the entity selected should be saved to an entity
-				// file. Note: Some mobs such as hostile mobs won't be saved. 
-				bool saveEntity = true; 
+			// Note: Hostile mobs won't be saved. 
+			if (mob.behavior != Mob::Behavior::Hostile)
+				entityData << "\n" << mob.getSaveString() << "\n";
 
-				switch (entityType) {
-				case Entity::Type::Mob:
-				{
-					const Mob& mob = dynamic_cast<Mob&>(*entity);
-					saveEntity = mob.behavior != Mob::Behavior::Hostile; 
-				}
-					break; 
-				case Entity::Type::ProjectileEntity:
-					saveEntity = false; 
-					break; 
-				}
+			removeMob(mobIndex); 
+		}
 
-				if (saveEntity)
-					ofile << "\n" << entity->getSaveString() << "\n";
+		itemEntityGrid.getChunkHandles(chunk.offset, chunkEntityHandles); 
 
-				delete entity; 
-				entities.erase(entities.begin() + entityPairIndex);
-				entityPairIndex--;
-			}
+		for (EntityHandle itemEntityHandle : chunkEntityHandles) {
+			entityData << "\n" 
+				<< itemEntities.get(itemEntityHandle)->getSaveString() << "\n";
+			itemEntityGrid.remove(itemEntityHandle); 
 		}
 
+		// Projectiles are never saved. 
+		projectileEntityGrid.getChunkHandles(chunk.offset, chunkEntityHandles); 
+
+		for (EntityHandle projectileEntityHandle : chunkEntityHandles)
+			projectileEntityGrid.remove(projectileEntityHandle); 
+
+		const std::string entityFileContents = entityData.str(); 
+
+		// Entity files which haven't changed since they were loaded aren't 
+		// written again. 
+		if (std::hash<std::string>()(entityFileContents) == chunk.entityFileHash)
+			return; 
+
+		std::ofstream ofile(getChunkEntitySaveFileName(chunk.offset));
+
+		ofile << entityFileContents; 
 		ofile.close();
 	}
 	void World::savePlayer() {
@@ -1548,6 +1620,9 @@ namespace engine {
 				< verticalBlockUpdateRange.y; blockPosition.y++)
 			{
 				Block& block = getBlockRef(blockPosition); 
+				// Compared against after the update, so only visible changes
+				// invalidate the chunk's caches. 
+				const Block prvsBlock = block; 
 
 				const BlockInfo::BlockUpdate blockUpdate =
 					static_cast<BlockInfo::BlockUpdate>(block.getVar(
@@ -1944,6 +2019,7 @@ namespace engine {
 										blockToLeftRef.tags.fluidLevel = std::min(
 											blockToLeft.tags.fluidLevel, fluid.tags.fluidLevel
 										); 
+										invalidateBlockChanges(blockToLeftPosition, blockToLeft); 
 									}
 
 									if (blockToRight.isFluidBreakable()) {
@@ -1956,6 +2032,7 @@ namespace engine {
 										blockToRightRef.tags.fluidLevel = std::min(
 											blockToRight.tags.fluidLevel, fluid.tags.fluidLevel
 										);
+										invalidateBlockChanges(blockToRightPosition, blockToRight); 
 									}
 								}
 
@@ -1985,6 +2062,8 @@ namespace engine {
 
 					blocksUpdated++; 
 				}
+
+				invalidateBlockChanges(blockPosition, prvsBlock); 
 			}
 		}
 
@@ -1995,10 +2074,8 @@ namespace engine {
 			for (blockPosition.y = verticalBlockUpdateRange.x; blockPosition.y 
 				< verticalBlockUpdateRange.y; blockPosition.y++)
 			{
-				Block& block = getBlockRef(blockPosition);
-
-				if (block.updateState == Block::UpdateState::UpdateNext)
-					block.updateState = Block::UpdateState::NeedsUpdate;
+				if (getBlock(blockPosition).updateState == Block::UpdateState::UpdateNext)
+					getBlockRef(blockPosition).updateState = Block::UpdateState::NeedsUpdate;
 			}
 		}
 	}